@@ -2,8 +2,10 @@ tool
 extends EditorPlugin
 
 const AkEventGizmo = preload("res://wwise/editor/ak_event_gizmo.gd")
+const AkGeometryBaker = preload("res://wwise/editor/ak_geometry_baker.gd")
 
 var ak_event_gizmo = AkEventGizmo.new()
+var ak_geometry_baker = AkGeometryBaker.new()
 
 func _enter_tree():
 	var node_image = Image.new()
@@ -21,6 +23,8 @@ func _enter_tree():
 	add_custom_type("AkState", "Node", preload("res://wwise/runtime/nodes/ak_state.gd"), node_icon)
 	add_custom_type("AkSwitch", "Node", preload("res://wwise/runtime/nodes/ak_switch.gd"), node_icon)
 	add_custom_type("AkEnvironment", "Area", preload("res://wwise/runtime/nodes/ak_environment.gd"), node_icon)
+	add_custom_type("AkClusteredEmitter", "Spatial", preload("res://wwise/runtime/nodes/ak_clustered_emitter.gd"), 
+			node_icon)
 	add_spatial_gizmo_plugin(ak_event_gizmo)
 	
 	# Spatial Audio Nodes
@@ -28,6 +32,7 @@ func _enter_tree():
 	add_custom_type("AkRoom", "Area", preload("res://wwise/runtime/nodes/ak_room.gd"), node_icon)
 	add_custom_type("AkPortal", "Area", preload("res://wwise/runtime/nodes/ak_portal.gd"), node_icon)
 	add_custom_type("AkEarlyReflections", "Node", preload("res://wwise/runtime/nodes/ak_early_reflections.gd"), node_icon)
+	add_tool_menu_item("Bake Acoustic Geometry", self, "_bake_acoustic_geometry")
 	
 	# 2D Nodes
 	add_custom_type("AkEvent2D", "Node2D", preload("res://wwise/runtime/nodes/ak_event_2d.gd"), node_icon)
@@ -47,6 +52,7 @@ func _enter_tree():
 
 	# Resources
 	add_custom_type("AkAcousticTexture", "Resource", preload("res://wwise/runtime/nodes/ak_acoustic_texture.gd"), node_icon)
+	add_custom_type("AkBakedGeometry", "Resource", preload("res://wwise/runtime/nodes/ak_baked_geometry.gd"), node_icon)
 			
 func _exit_tree():
 	# 3D Nodes
@@ -56,6 +62,7 @@ func _exit_tree():
 	remove_custom_type("AkState")
 	remove_custom_type("AkSwitch")
 	remove_custom_type("AkEnvironment")
+	remove_custom_type("AkClusteredEmitter")
 	remove_spatial_gizmo_plugin(ak_event_gizmo)
 	
 	# Spatial Audio Nodes
@@ -63,6 +70,7 @@ func _exit_tree():
 	remove_custom_type("AkRoom")
 	remove_custom_type("AkPortal")
 	remove_custom_type("AkEarlyReflections")
+	remove_tool_menu_item("Bake Acoustic Geometry")
 	
 	# 2D Nodes
 	remove_custom_type("AkEvent2D")
@@ -82,3 +90,13 @@ func _exit_tree():
 
 	#Resources
 	remove_custom_type("AkAcousticTexture")
+	remove_custom_type("AkBakedGeometry")
+
+func _bake_acoustic_geometry(_ud) -> void:
+	var root:Node = get_editor_interface().get_edited_scene_root()
+	if not root or root.filename.empty():
+		push_error("Save the scene before baking its acoustic geometry")
+		return
+	var baked_count:int = ak_geometry_baker.bake_scene(root)
+	get_editor_interface().mark_scene_as_unsaved()
+	print("Baked ", baked_count, " AkGeometry nodes")
@@ -0,0 +1,36 @@
+extends Node
+
+# Runs the native benchmarks of a library built with scons benchmarks=yes and writes the results as JSON, run with
+# godot res://test/benchmarks/benchmarks.tscn -- --output=<path>
+const DEFAULT_OUTPUT_PATH = "user://wwise_benchmarks.json"
+
+func _ready():
+	if not Wwise.has_method("run_benchmarks"):
+		printerr("The Wwise library was built without benchmarks, rebuild it with scons benchmarks=yes")
+		get_tree().quit(1)
+		return
+	
+	Wwise.load_bank_id(AK.BANKS.INIT)
+	Wwise.load_bank_id(AK.BANKS.TESTBANK)
+	
+	var results = Wwise.run_benchmarks({"event_id": AK.EVENTS.PLAY_CHIMES_WITH_MARKER})
+	
+	Wwise.unload_bank_id(AK.BANKS.TESTBANK)
+	Wwise.unload_bank_id(AK.BANKS.INIT)
+	
+	var output_path = DEFAULT_OUTPUT_PATH
+	for argument in OS.get_cmdline_args():
+		if argument.begins_with("--output="):
+			output_path = argument.trim_prefix("--output=")
+	
+	var file = File.new()
+	if file.open(output_path, File.WRITE) != OK:
+		printerr("Failed to write the benchmark results to ", output_path)
+		get_tree().quit(1)
+		return
+	
+	file.store_string(to_json(results))
+	file.close()
+	
+	print("Benchmark results written to ", output_path)
+	get_tree().quit()
@@ -0,0 +1,57 @@
+extends Reference
+
+# Builds stress scenes for the performance tests: emitters laid out on a grid, meshes registered as acoustic geometry
+# and a share of the emitters posting events with callbacks, which makes every callback signal fan out to all of them.
+# The scenes can also be saved to disk and opened in the editor.
+const AkEvent = preload("res://wwise/runtime/nodes/ak_event.gd")
+const AkGeometry = preload("res://wwise/runtime/nodes/ak_geometry.gd")
+
+const EMITTER_SPACING:float = 2.0
+const GEOMETRY_SPACING:float = 20.0
+const GEOMETRY_SUBDIVISIONS:int = 16
+
+func build(emitter_count:int, geometry_count:int, callback_emitter_count:int) -> Spatial:
+	var root:Spatial = Spatial.new()
+	root.set_name("StressScene")
+	
+	var grid_size:int = int(ceil(sqrt(emitter_count)))
+	for i in range(emitter_count):
+		var emitter = AkEvent.new()
+		emitter.set_name("AkEvent" + str(i))
+		emitter.translation = Vector3((i % grid_size) * EMITTER_SPACING, 0.0, (i / grid_size) * EMITTER_SPACING)
+		if i < callback_emitter_count:
+			emitter.event = AK.EVENTS.PLAY_CHIMES_WITH_MARKER
+			emitter.trigger_on = AkUtils.GameEvent.READY
+			emitter.use_callback = true
+			emitter.callback_flag = AkUtils.AkCallbackType.AK_EndOfEvent | AkUtils.AkCallbackType.AK_Marker
+		root.add_child(emitter)
+		emitter.set_owner(root)
+	
+	var geometry_grid_size:int = int(ceil(sqrt(geometry_count)))
+	for i in range(geometry_count):
+		var plane:PlaneMesh = PlaneMesh.new()
+		plane.size = Vector2(GEOMETRY_SPACING, GEOMETRY_SPACING) * 0.5
+		plane.subdivide_width = GEOMETRY_SUBDIVISIONS
+		plane.subdivide_depth = GEOMETRY_SUBDIVISIONS
+		
+		var mesh_instance:MeshInstance = MeshInstance.new()
+		mesh_instance.set_name("Mesh" + str(i))
+		mesh_instance.mesh = plane
+		mesh_instance.translation = Vector3((i % geometry_grid_size) * GEOMETRY_SPACING, -1.0,
+				(i / geometry_grid_size) * GEOMETRY_SPACING)
+		root.add_child(mesh_instance)
+		mesh_instance.set_owner(root)
+		
+		var geometry = AkGeometry.new()
+		geometry.set_name("AkGeometry")
+		mesh_instance.add_child(geometry)
+		geometry.set_owner(root)
+	
+	return root
+	
+func save(root:Node, path:String) -> int:
+	var scene:PackedScene = PackedScene.new()
+	var result:int = scene.pack(root)
+	if result != OK:
+		return result
+	return ResourceSaver.save(path, scene)
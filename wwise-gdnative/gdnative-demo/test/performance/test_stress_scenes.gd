@@ -0,0 +1,65 @@
+extends "res://addons/gut/test.gd"
+
+class TestStressScenes:
+	extends "res://addons/gut/test.gd"
+	
+	# Frame budgets in milliseconds for each scene size, averaged over SAMPLE_FRAMES frames on the reference hardware.
+	# The API profiler is only compiled in debug builds, so these are debug build timings.
+	const SAMPLE_FRAMES:int = 60
+	const SCENES = [
+		{"emitters": 1000, "geometry": 10, "callback_emitters": 100,
+		 "budgets": {"process": 2.0, "set_3d_position": 2.0, "emit_signals": 1.0}},
+		{"emitters": 10000, "geometry": 50, "callback_emitters": 500,
+		 "budgets": {"process": 8.0, "set_3d_position": 16.0, "emit_signals": 4.0}},
+		{"emitters": 50000, "geometry": 100, "callback_emitters": 1000,
+		 "budgets": {"process": 30.0, "set_3d_position": 80.0, "emit_signals": 8.0}}
+	]
+	
+	const StressSceneBuilder = preload("res://test/performance/stress_scene_builder.gd")
+	
+	var builder = StressSceneBuilder.new()
+	
+	func before_all():
+		Wwise.load_bank_id(AK.BANKS.INIT)
+		Wwise.load_bank_id(AK.BANKS.TESTBANK)
+		
+	func after_all():
+		Wwise.unload_bank_id(AK.BANKS.TESTBANK)
+		Wwise.unload_bank_id(AK.BANKS.INIT)
+	
+	func test_assert_stress_scene_budgets():
+		if not OS.is_debug_build():
+			return
+		for scene in SCENES:
+			var root:Spatial = builder.build(scene["emitters"], scene["geometry"], scene["callback_emitters"])
+			add_child(root)
+			yield(yield_for(0.5), YIELD)
+			
+			var frame_times:Dictionary = yield(measure_frame_times(scene["budgets"].keys()), "completed")
+			
+			remove_child(root)
+			for child in root.get_children():
+				if child.get_class() == "AkEvent":
+					Wwise.unregister_game_obj(child)
+			root.free()
+			
+			for method in scene["budgets"]:
+				gut.p(str(scene["emitters"]) + " emitters, " + method + ": " + str(frame_times[method]) + " ms")
+				assert_true(frame_times[method] <= scene["budgets"][method],
+						method + " should stay within " + str(scene["budgets"][method]) + " ms with " +
+						str(scene["emitters"]) + " emitters")
+	
+	func measure_frame_times(methods:Array):
+		var frame_times:Dictionary = {}
+		for method in methods:
+			frame_times[method] = 0.0
+		
+		Wwise.set_api_profiling_enabled(true)
+		for _frame in range(SAMPLE_FRAMES):
+			yield(get_tree(), "idle_frame")
+			for entry in Wwise.get_api_report(0):
+				if frame_times.has(entry["method"]):
+					frame_times[entry["method"]] += entry["frame_time_ms"] / SAMPLE_FRAMES
+		Wwise.set_api_profiling_enabled(false)
+		
+		return frame_times
@@ -0,0 +1,73 @@
+extends "res://addons/gut/test.gd"
+
+class TestCallLog:
+	extends "res://addons/gut/test.gd"
+	
+	func test_assert_record_and_replay():
+		var node: Node = Node.new()
+		Wwise.start_call_recording()
+		Wwise.register_game_obj(node, "Test")
+		Wwise.set_rtpc("Enemies", 10.0, node)
+		yield(yield_for(0.1), YIELD)
+		Wwise.post_event("Play_chimes_with_marker", node)
+		Wwise.unregister_game_obj(node)
+		Wwise.stop_call_recording()
+		assert_true(Wwise.save_call_recording("user://test_calls.log"), "Call log should be saved")
+		if Wwise.get_stats()["offline_rendering"]:
+			var result:Dictionary = Wwise.replay_call_log("user://test_calls.log")
+			assert_true(result["calls"] == 4, "All recorded calls should be replayed")
+			assert_true(result["game_objects"] == 1, "Game objects should be remapped to one placeholder")
+			assert_true(result["frames"] > 1, "Calls from different frames should be replayed on different frames")
+		node.free()
+		
+	func test_assert_replay_corrupt_log():
+		var file = File.new()
+		assert_true(file.open("user://test_corrupt_calls.log", File.WRITE) == OK, "Corrupt call log should be written")
+		file.store_32(0x4C525757)
+		file.store_32(1)
+		# Method count far larger than the rest of the log could hold
+		file.store_32(0xFFFFFFFF)
+		file.close()
+		if Wwise.get_stats()["offline_rendering"]:
+			assert_true(Wwise.replay_call_log("user://test_corrupt_calls.log").empty(), 
+						"Corrupt call log should not be replayed")
+		
+	func test_assert_replay_log_with_frames_going_backwards():
+		var file = File.new()
+		assert_true(file.open("user://test_backwards_calls.log", File.WRITE) == OK, "Call log should be written")
+		file.store_32(0x4C525757)
+		file.store_32(1)
+		file.store_32(1)
+		file.store_32(8)
+		file.store_buffer("set_rtpc".to_utf8())
+		file.store_32(0)
+		for frame in [5, 2]:
+			file.store_32(frame)
+			file.store_16(0)
+			file.store_8(0)
+		file.close()
+		if Wwise.get_stats()["offline_rendering"]:
+			assert_true(Wwise.replay_call_log("user://test_backwards_calls.log").empty(), 
+						"Call log with frames going backwards should not be replayed")
+		
+	func test_assert_replay_log_with_deep_nesting():
+		var file = File.new()
+		assert_true(file.open("user://test_nested_calls.log", File.WRITE) == OK, "Call log should be written")
+		file.store_32(0x4C525757)
+		file.store_32(1)
+		file.store_32(1)
+		file.store_32(8)
+		file.store_buffer("set_rtpc".to_utf8())
+		file.store_32(0)
+		file.store_32(0)
+		file.store_16(0)
+		file.store_8(1)
+		# Arrays nested far deeper than any recorded argument
+		for i in range(1000):
+			file.store_8(8)
+			file.store_32(1)
+		file.store_8(0)
+		file.close()
+		if Wwise.get_stats()["offline_rendering"]:
+			assert_true(Wwise.replay_call_log("user://test_nested_calls.log").empty(), 
+						"Call log with deeply nested arguments should not be replayed")
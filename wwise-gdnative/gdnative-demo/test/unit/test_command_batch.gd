@@ -0,0 +1,25 @@
+extends "res://addons/gut/test.gd"
+
+class TestCommandBatch:
+	extends "res://addons/gut/test.gd"
+	
+	func test_assert_command_latency():
+		var node: Node = Node.new()
+		Wwise.register_game_obj(node, "Test")
+		Wwise.begin_command_batch()
+		Wwise.set_rtpc("Enemies", 10.0, node)
+		Wwise.post_event("Play_chimes_with_marker", node)
+		Wwise.end_command_batch()
+		yield(yield_for(0.1), YIELD)
+		var stats:Dictionary = Wwise.get_stats()
+		Wwise.unregister_game_obj(node)
+		assert_true(stats.has("tick_mode"), "Stats should contain the render tick mode")
+		assert_true(stats["command_latency_peak_ms"] >= stats["command_latency_last_ms"], "Command latency peak should be at least the last latency")
+		node.free()
+	
+	func test_assert_unended_command_batch():
+		var render_audio_calls:int = Wwise.get_stats()["render_audio_calls"]
+		Wwise.begin_command_batch()
+		yield(yield_for(0.1), YIELD)
+		assert_true(Wwise.get_stats()["render_audio_calls"] > render_audio_calls, 
+					"Audio should keep rendering when a command batch is never ended")
@@ -0,0 +1,18 @@
+extends "res://addons/gut/test.gd"
+
+class TestMemory:
+	extends "res://addons/gut/test.gd"
+	
+	func test_assert_memory_stats():
+		var stats:Dictionary = Wwise.get_memory_stats()
+		assert_true(stats.has("categories"), "Memory stats should contain the per-category usage")
+		if stats["pool_enabled"]:
+			assert_true(stats["pool_used"] <= stats["pool_budget"], "Pool usage should stay within the budget")
+			assert_true(stats["pool_peak_used"] >= stats["pool_used"], "Pool peak should be at least the current usage")
+	
+	func test_assert_stats():
+		yield(yield_for(0.1), YIELD)
+		var stats:Dictionary = Wwise.get_stats()
+		assert_true(stats.has("memory"), "Stats should contain the memory stats")
+		assert_true(stats["render_audio_calls"] > 0, "RenderAudio should have been timed")
+		assert_true(stats["render_audio_peak_ms"] >= stats["render_audio_last_ms"], "RenderAudio peak should be at least the last time")
@@ -0,0 +1,12 @@
+extends "res://addons/gut/test.gd"
+
+class TestOfflineRendering:
+	extends "res://addons/gut/test.gd"
+	
+	func test_assert_render_frames():
+		if not Wwise.get_stats()["offline_rendering"]:
+			return
+		var result:Dictionary = Wwise.render_frames(100)
+		assert_true(result["frames"] == 100, "All requested frames should have been rendered")
+		assert_true(result["audio_time_ms"] > 0.0, "Rendered frames should advance the audio time")
+		assert_true(result["peak_frame_ms"] <= result["total_ms"], "Peak frame time should stay within the total time")
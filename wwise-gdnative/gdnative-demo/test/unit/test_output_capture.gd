@@ -0,0 +1,23 @@
+extends "res://addons/gut/test.gd"
+
+class TestOutputCapture:
+	extends "res://addons/gut/test.gd"
+	
+	func test_assert_capture_frames():
+		var node: Node = Node.new()
+		Wwise.register_game_obj(node, "Test")
+		assert_true(Wwise.start_output_capture(1.0), "Output capture should start")
+		Wwise.post_event("Play_chimes_with_marker", node)
+		if Wwise.get_stats()["offline_rendering"]:
+			Wwise.render_frames(20)
+		else:
+			yield(yield_for(0.2), YIELD)
+		var info:Dictionary = Wwise.get_output_capture_info()
+		var frames:PoolRealArray = Wwise.read_captured_frames(0)
+		var pcm:PoolByteArray = Wwise.read_captured_pcm16(0)
+		Wwise.stop_output_capture()
+		Wwise.unregister_game_obj(node)
+		assert_true(info["captured_frames"] > 0, "Rendered frames should have been captured")
+		assert_true(frames.size() == info["available_frames"] * info["channels"], "All available frames should have been read")
+		assert_true(pcm.size() % (2 * info["channels"]) == 0, "PCM data should contain whole frames")
+		node.free()
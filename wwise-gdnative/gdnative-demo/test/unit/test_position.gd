@@ -27,6 +27,29 @@ class TestPosition:
 		assert_true(Wwise.set_2d_position(node2d, node2d.transform, node2d.z_index), "Setting 2D Position should be true")
 		Wwise.unregister_game_obj(node2d)
 		
+	func test_assert_set_game_obj_max_radius():
+		var listener:Spatial = Spatial.new()
+		Wwise.register_listener(listener)
+		Wwise.set_3d_position(listener, Transform())
+		Wwise.register_game_obj(spatial, spatial.get_name())
+		assert_true(Wwise.set_game_obj_max_radius(spatial, 10.0), "Set Game Obj Max Radius should be true")
+		Wwise.set_3d_position(spatial, Transform(Basis(), Vector3(100, 0, 0)))
+		yield(yield_for(0.1), YIELD)
+		assert_true(Wwise.get_game_obj_lod_tier(spatial) == 2, "Game Obj out of audible range should be suspended")
+		assert_true(Wwise.get_emitter_lod_stats()["suspended"] == 1, "LOD stats should count the suspended Game Obj")
+		Wwise.set_3d_position(spatial, Transform(Basis(), Vector3(1, 0, 0)))
+		yield(yield_for(0.1), YIELD)
+		assert_true(Wwise.get_game_obj_lod_tier(spatial) == 0, "Game Obj close to the Listener should be full rate")
+		# Unregistering the Listener takes it out of the emitter LOD, nothing is culled without one
+		Wwise.unregister_game_obj(listener)
+		listener.free()
+		Wwise.set_3d_position(spatial, Transform(Basis(), Vector3(100, 0, 0)))
+		yield(yield_for(0.1), YIELD)
+		assert_true(Wwise.get_game_obj_lod_tier(spatial) == 0, 
+					"Game Obj should not be culled against an unregistered Listener")
+		Wwise.set_game_obj_max_radius(spatial, 0.0)
+		Wwise.unregister_game_obj(spatial)
+		
 	func after_all():
 		Wwise.unload_bank_id(AK.BANKS.TESTBANK)	
 		Wwise.unload_bank_id(AK.BANKS.INIT)
@@ -80,6 +80,34 @@ class TestPostEvent:
 		assert_true(segment_info.iCurrentPosition > 0, "Current Position of Segment Info should be greater than 0")
 		Wwise.stop_event(playing_id, 0, AkUtils.AkCurveInterpolation.LINEAR)
 		
+	func test_assert_set_clustered_emitter():
+		var emitters:Array = [Node.new(), Node.new(), Node.new()]
+		var origins:Array = [Vector3(0, 0, 0), Vector3(1, 0, 0), Vector3(1000, 0, 0)]
+		for i in emitters.size():
+			assert_true(Wwise.set_clustered_emitter(emitters[i], AK.EVENTS.PLAY_CHIMES_WITH_MARKER, 
+						Transform(Basis(), origins[i])), "Set Clustered Emitter should be true")
+		yield(yield_for(0.1), YIELD)
+		assert_true(Wwise.get_emitter_cluster(emitters[0]) == Wwise.get_emitter_cluster(emitters[1]), 
+					"Nearby emitters of the same event should share a cluster")
+		assert_true(Wwise.get_emitter_cluster_count() == 2, "Far away emitter should get a cluster of its own")
+		for emitter in emitters:
+			assert_true(Wwise.remove_clustered_emitter(emitter), "Remove Clustered Emitter should be true")
+			emitter.free()
+		yield(yield_for(0.1), YIELD)
+		assert_true(Wwise.get_emitter_cluster_count() == 0, "Clusters should be removed with their last emitter")
+		
+	func test_assert_post_event_at_position():
+		var playing_id = Wwise.post_event_at_position(AK.EVENTS.PLAY_CHIMES_WITH_MARKER, 
+					Transform(Basis(), Vector3(5, 0, 0)))
+		assert_true(playing_id > 0, "Playing ID of Post Event At Position should be greater than 0")
+		var stats:Dictionary = Wwise.get_transient_game_obj_stats()
+		assert_true(stats.in_use >= 1, "A transient game object should be in use")
+		assert_true(stats.pool_size <= stats.max_pool_size, "Transient pool should not grow past its max size")
+		Wwise.stop_event(playing_id, 0, AkUtils.AkCurveInterpolation.LINEAR)
+		yield(yield_for(0.5), YIELD)
+		assert_true(Wwise.get_transient_game_obj_stats().in_use == 0, 
+					"Transient game object should return to the pool at the end of the event")
+		
 	func after_all():
 		Wwise.unregister_game_obj(node)		
 		Wwise.unload_bank_id(AK.BANKS.TESTBANK)	
@@ -0,0 +1,21 @@
+extends "res://addons/gut/test.gd"
+
+class TestProfiler:
+	extends "res://addons/gut/test.gd"
+	
+	func test_assert_api_report():
+		if not OS.is_debug_build():
+			return
+		var node: Node = Node.new()
+		Wwise.set_api_profiling_enabled(true)
+		Wwise.register_game_obj(node, "Test")
+		Wwise.set_rtpc("Enemies", 10.0, node)
+		yield(yield_for(0.1), YIELD)
+		var report:Array = Wwise.get_api_report(0)
+		Wwise.set_api_profiling_enabled(false)
+		Wwise.unregister_game_obj(node)
+		var methods = []
+		for entry in report:
+			methods.append(entry["method"])
+		assert_true(methods.has("set_rtpc"), "API report should contain set_rtpc")
+		node.free()
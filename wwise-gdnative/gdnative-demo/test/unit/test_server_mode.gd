@@ -0,0 +1,17 @@
+extends "res://addons/gut/test.gd"
+
+class TestServerMode:
+	extends "res://addons/gut/test.gd"
+	
+	func test_assert_server_game_syncs():
+		if not Wwise.is_server_mode():
+			return
+		var node: Node = Node.new()
+		assert_true(Wwise.register_game_obj(node, "Test"), "Registering a game object should succeed in server mode")
+		assert_true(Wwise.set_rtpc("Enemies", 10.0, node), "Setting an RTPC should succeed in server mode")
+		assert_true(Wwise.set_state("Music_State", "Normal"), "Setting a state should succeed in server mode")
+		assert_true(Wwise.get_rtpc("Enemies", node) == 10.0, "The recorded RTPC value should be returned")
+		assert_true(Wwise.get_server_game_syncs()["states"]["Music_State"] == "Normal", "The state should be recorded")
+		Wwise.unregister_game_obj(node)
+		assert_true(not Wwise.get_server_game_syncs()["rtpcs"].has(node.get_instance_id()), "Unregistering should drop the game object values")
+		node.free()
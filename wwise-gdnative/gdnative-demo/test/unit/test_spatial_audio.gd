@@ -21,6 +21,98 @@ class TestSpatialAudio:
 		assert_true(ak_geometry.set_geometry(mesh_instance), "Set Geometry should by true")
 		Wwise.remove_geometry(ak_geometry)
 	
+	func test_assert_set_geometry_welds_vertices():
+		var node: Node = Node.new()
+		node.name = "Test"
+		# Two triangles of a quad with unshared vertices, plus one that collapses to a line once welded
+		var vertices = PoolVector3Array([Vector3(0, 0, 0), Vector3(1, 0, 0), Vector3(0, 0, 1), 
+										 Vector3(1, 0, 0), Vector3(1, 0, 1), Vector3(0, 0, 1.0001)])
+		var triangles = PoolIntArray([0, 1, 2, 3, 4, 5, 0, 1, 3])
+		assert_true(Wwise.set_geometry(vertices, triangles, null, 1.0, node, false, false, null), 
+					"Set Geometry should be true")
+		Wwise.remove_geometry(node)
+		node.free()
+	
+	func test_assert_set_geometry_with_surfaces():
+		var node: Node = Node.new()
+		node.name = "Test"
+		# A floor and a wall sharing an edge, each on its own surface
+		var vertices = PoolVector3Array([Vector3(0, 0, 0), Vector3(1, 0, 0), Vector3(0, 0, 1), Vector3(1, 0, 1), 
+										 Vector3(0, 1, 0), Vector3(1, 1, 0)])
+		var triangles = PoolIntArray([0, 2, 1, 1, 2, 3, 0, 1, 4, 1, 5, 4])
+		var textures = [load("res://wwise/resources/acoustic_textures/TestTexture.tres"), null]
+		assert_true(Wwise.set_geometry_with_surfaces(vertices, triangles, PoolIntArray([0, 0, 1, 1]), textures, 1.0, 
+					node, false, false, null), "Set Geometry with Surfaces should be true")
+		assert_true(Wwise.get_geometry_stats(node)["surfaces"] == 2, "Geometry should have 2 surfaces")
+		assert_true(not Wwise.set_geometry_with_surfaces(vertices, triangles, PoolIntArray([0, 0, 1, 2]), textures, 
+					1.0, node, false, false, null), "Set Geometry with Surfaces should be false for a missing surface")
+		Wwise.remove_geometry(node)
+		node.free()
+	
+	func test_assert_set_geometry_from_mesh():
+		var node: Node = Node.new()
+		node.name = "Test"
+		var transform = Transform(Basis(Vector3.UP, PI / 4), Vector3(1, 2, 3))
+		assert_true(Wwise.set_geometry_from_mesh(CubeMesh.new(), transform, null, [], 1.0, node, false, false, null), 
+					"Set Geometry from Mesh should be true")
+		Wwise.remove_geometry(node)
+		node.free()
+	
+	func test_assert_set_geometry_async():
+		var node: Node = Node.new()
+		node.name = "Test"
+		assert_true(Wwise.set_geometry_from_mesh_async(CubeMesh.new(), Transform(), null, [], 1.0, node, false, false, 
+					null), "Set Geometry from Mesh Async should be true")
+		assert_true(Wwise.get_geometry_stats(node).empty(), "Geometry should not be registered before it is built")
+		yield(yield_to(Wwise, "geometry_callback", 1.0), YIELD)
+		assert_true(Wwise.get_geometry_stats(node)["vertices"] == 8, "Geometry should be registered once built")
+		Wwise.remove_geometry(node)
+		node.free()
+	
+	func test_assert_set_geometry_transform():
+		var node: Node = Node.new()
+		node.name = "Test"
+		Wwise.set_geometry_from_mesh(CubeMesh.new(), Transform(), null, [], 1.0, node, false, false, null)
+		assert_true(Wwise.set_geometry_transform(node, Transform(Basis(), Vector3(0, 0, 5))), 
+					"Set Geometry Transform should be true")
+		Wwise.remove_geometry(node)
+		assert_true(not Wwise.set_geometry_transform(node, Transform()), 
+					"Set Geometry Transform should be false once the geometry is removed")
+		node.free()
+	
+	func test_assert_set_geometry_simplification():
+		var node: Node = Node.new()
+		node.name = "Test"
+		var plane = PlaneMesh.new()
+		plane.subdivide_width = 15
+		plane.subdivide_depth = 15
+		assert_true(Wwise.set_geometry_simplification(node, 0, 0.01), "Set Geometry Simplification should be true")
+		Wwise.set_geometry_from_mesh(plane, Transform(), null, [], 1.0, node, false, false, null)
+		var stats: Dictionary = Wwise.get_geometry_stats(node)
+		assert_true(stats["source_triangles"] == 512, "Subdivided plane should have 512 source triangles")
+		assert_true(stats["triangles"] == 2, "Flat plane should simplify down to 2 triangles")
+		Wwise.remove_geometry(node)
+		node.free()
+
+	func test_assert_set_geometry_from_baked():
+		var node: Node = Node.new()
+		node.name = "Test"
+		var baker = load("res://wwise/bin/wwise-geometry-baker.gdns").new()
+		var baked: Dictionary = baker.bake(CubeMesh.new(), 0.001, 0, 0.0)
+		assert_true(baked["vertices"] == 8, "Baked cube should have 8 welded vertices")
+		assert_true(Wwise.set_geometry_from_baked(baked["data"], Transform(), null, [], 1.0, node, false, false, null),
+					"Set Geometry from Baked should be true")
+		Wwise.remove_geometry(node)
+		assert_true(not Wwise.set_geometry_from_baked(PoolByteArray([1, 2, 3]), Transform(), null, [], 1.0, node,
+					false, false, null), "Set Geometry from Baked should be false for invalid data")
+		var corrupt: PoolByteArray = baked["data"]
+		# First index of the last triangle, pointing past the 8 vertices
+		corrupt[corrupt.size() - 8] = 255
+		corrupt[corrupt.size() - 7] = 255
+		assert_true(not Wwise.set_geometry_from_baked(corrupt, Transform(), null, [], 1.0, node, false, false, null),
+					"Set Geometry from Baked should be false for out of range triangle indices")
+		node.free()
+
 	func test_assert_remove_geometry():
 		var ak_geometry = preload("res://wwise/runtime/nodes/ak_geometry.gd").new()
 		ak_geometry.name = "AkGeometry"
@@ -78,6 +170,72 @@ class TestSpatialAudio:
 										 enabled, portal_name), "Set Portal should be true")
 			Wwise.remove_portal(spatial)
 			
+	func test_assert_add_room_volume():
+		var game_obj:Node = Node.new()
+		game_obj.name = "Game Object Test"
+		Wwise.register_game_obj(game_obj, game_obj.get_name())
+		var room:Node = Node.new()
+		room.name = "Test Room"
+		Wwise.set_room(room, AK.AUX_BUSSES.LARGEVERB, room.get_name())
+		assert_true(Wwise.add_room_volume(room, Transform(Basis(), Vector3(10, 0, 0)), Vector3(2, 2, 2), 0), 
+					"Add Room Volume should be true")
+		Wwise.set_3d_position(game_obj, Transform(Basis(), Vector3(11, 1, -1)))
+		yield(yield_for(0.1), YIELD)
+		assert_true(Wwise.get_game_obj_room(game_obj) == room.get_instance_id(), 
+					"Game Obj should be in the Room once it is inside its volume")
+		Wwise.set_3d_position(game_obj, Transform(Basis(), Vector3(0, 0, 0)))
+		yield(yield_for(0.1), YIELD)
+		assert_true(Wwise.get_game_obj_room(game_obj) == 0, "Game Obj should leave the Room once outside its volume")
+		Wwise.remove_room(room)
+		Wwise.unregister_game_obj(game_obj)
+		
+	func test_assert_add_environment_zone():
+		var game_obj:Node = Node.new()
+		game_obj.name = "Game Object Test"
+		Wwise.register_game_obj(game_obj, game_obj.get_name())
+		Wwise.set_game_obj_environment_aware(game_obj, true)
+		var zone:Node = Node.new()
+		assert_true(Wwise.add_environment_zone(zone, AK.AUX_BUSSES.LARGEVERB, Transform(Basis(), Vector3(10, 0, 0)), 
+					Vector3(2, 2, 2), 0, 2.0), "Add Environment Zone should be true")
+		Wwise.set_3d_position(game_obj, Transform(Basis(), Vector3(11, 1, -1)))
+		yield(yield_for(0.1), YIELD)
+		var sends:Array = Wwise.get_game_obj_aux_sends(game_obj)
+		assert_true(sends.size() == 1 and sends[0]["control_value"] == 1.0, 
+					"Game Obj should fully send to the aux bus inside the zone")
+		Wwise.set_3d_position(game_obj, Transform(Basis(), Vector3(13, 0, 0)))
+		yield(yield_for(0.1), YIELD)
+		sends = Wwise.get_game_obj_aux_sends(game_obj)
+		assert_true(sends.size() == 1 and abs(sends[0]["control_value"] - 0.5) < 0.01, 
+					"Send should fade out with the distance from the zone")
+		Wwise.remove_environment_zone(zone)
+		yield(yield_for(0.1), YIELD)
+		assert_true(Wwise.get_game_obj_aux_sends(game_obj).empty(), "Send should stop once the zone is removed")
+		Wwise.unregister_game_obj(game_obj)
+		zone.free()
+		
+	func test_assert_set_game_obj_occlusion():
+		var emitter:Spatial = Spatial.new()
+		var listener:Spatial = Spatial.new()
+		var wall:StaticBody = StaticBody.new()
+		var wall_shape:CollisionShape = CollisionShape.new()
+		wall_shape.shape = BoxShape.new()
+		wall.add_child(wall_shape)
+		wall.transform.origin = Vector3(100, 0, 5)
+		for node in [emitter, listener, wall]:
+			get_tree().get_root().add_child(node)
+		Wwise.register_game_obj(emitter, "Emitter Test")
+		Wwise.register_game_obj(listener, "Listener Test")
+		Wwise.set_3d_position(emitter, Transform(Basis(), Vector3(100, 0, 0)))
+		Wwise.set_3d_position(listener, Transform(Basis(), Vector3(100, 0, 10)))
+		assert_true(Wwise.set_game_obj_occlusion(emitter, listener, 0), "Set Game Obj Occlusion should be true")
+		yield(yield_for(0.5), YIELD)
+		assert_true(Wwise.get_game_obj_occlusion(emitter) > 0.0, "Wall between Emitter and Listener should occlude")
+		assert_true(Wwise.remove_game_obj_occlusion(emitter), "Remove Game Obj Occlusion should be true")
+		Wwise.unregister_game_obj(emitter)
+		Wwise.unregister_game_obj(listener)
+		for node in [emitter, listener, wall]:
+			node.queue_free()
+		
 	func test_assert_set_game_obj_in_room():
 		var game_obj:Node = Node.new()
 		game_obj.name = "Game Object Test"
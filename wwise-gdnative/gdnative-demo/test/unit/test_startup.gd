@@ -0,0 +1,10 @@
+extends "res://addons/gut/test.gd"
+
+class TestStartup:
+	extends "res://addons/gut/test.gd"
+	
+	func test_assert_startup_timings():
+		var timings:Dictionary = Wwise.get_startup_timings()
+		assert_true(timings.has("sound_engine"), "Startup timings should contain the sound engine phase")
+		assert_true(timings.has("total"), "Startup timings should contain the total")
+		assert_true(timings["total"] >= timings["sound_engine"], "Total startup time should include every phase")
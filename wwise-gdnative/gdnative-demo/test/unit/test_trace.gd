@@ -0,0 +1,20 @@
+extends "res://addons/gut/test.gd"
+
+class TestTrace:
+	extends "res://addons/gut/test.gd"
+	
+	const TRACE_PATH = "user://test_wwise_trace.json"
+	
+	func test_assert_flush_trace():
+		assert_true(Wwise.start_trace(4096), "Start Trace should be true")
+		yield(yield_for(0.1), YIELD)
+		Wwise.stop_trace()
+		assert_true(Wwise.flush_trace(TRACE_PATH), "Flush Trace should be true")
+		var file = File.new()
+		assert_true(file.file_exists(TRACE_PATH), "Trace file should exist")
+		file.open(TRACE_PATH, File.READ)
+		var parsed = JSON.parse(file.get_as_text())
+		file.close()
+		assert_eq(parsed.error, OK, "Trace file should be valid JSON")
+		assert_true(parsed.result["traceEvents"].size() > 0, "Trace should contain events")
+		Directory.new().remove(TRACE_PATH)
@@ -0,0 +1,54 @@
+extends Reference
+
+const AkGeometry = preload("res://wwise/runtime/nodes/ak_geometry.gd")
+const AkBakedGeometry = preload("res://wwise/runtime/nodes/ak_baked_geometry.gd")
+const WwiseGeometryBaker = preload("res://wwise/bin/wwise-geometry-baker.gdns")
+const WELD_TOLERANCE_SETTING = "wwise/common_advanced_settings/spatial_audio/geometry_weld_tolerance"
+
+# Bakes every AkGeometry under root into a resource saved next to the scene, returns the number of nodes baked
+func bake_scene(root:Node) -> int:
+	var weld_tolerance:float = 0.0
+	if ProjectSettings.has_setting(WELD_TOLERANCE_SETTING):
+		weld_tolerance = ProjectSettings.get_setting(WELD_TOLERANCE_SETTING)
+	
+	var baker = WwiseGeometryBaker.new()
+	var baked_count:int = 0
+	
+	for node in _find_geometry_nodes(root, []):
+		var mesh_instance = node.get_parent() as MeshInstance
+		if not mesh_instance or not mesh_instance.mesh:
+			push_warning("AkGeometry " + str(root.get_path_to(node)) + " is not the child of a MeshInstance")
+			continue
+		
+		var result:Dictionary = baker.bake(mesh_instance.mesh, weld_tolerance, node.simplify_target_triangles, 
+				node.simplify_max_error)
+		if result.empty():
+			push_error("Failed to bake AkGeometry " + str(root.get_path_to(node)))
+			continue
+		
+		var baked_geometry = AkBakedGeometry.new()
+		baked_geometry.data = result["data"]
+		baked_geometry.vertex_count = result["vertices"]
+		baked_geometry.triangle_count = result["triangles"]
+		
+		var path:String = _get_baked_geometry_path(root, node)
+		if ResourceSaver.save(path, baked_geometry) != OK:
+			push_error("Failed to save the baked geometry to " + path)
+			continue
+		
+		node.baked_geometry = load(path)
+		baked_count += 1
+	
+	return baked_count
+	
+func _find_geometry_nodes(node:Node, geometry_nodes:Array) -> Array:
+	if node is AkGeometry:
+		geometry_nodes.append(node)
+	for child in node.get_children():
+		_find_geometry_nodes(child, geometry_nodes)
+	return geometry_nodes
+	
+func _get_baked_geometry_path(root:Node, node:Node) -> String:
+	var scene_path:String = root.filename
+	var node_path:String = str(root.get_path_to(node)).replace("/", "_").replace(".", "_")
+	return scene_path.get_basename() + "_" + node_path + ".geometry.res"
@@ -8,6 +8,11 @@ export(AkUtils.GameEvent) var stop_on:int = AkUtils.GameEvent.NONE
 export(int) var stop_fade_time:int = 0
 export(AkUtils.AkCurveInterpolation) var stop_interpolation_curve:int = AkUtils.AkCurveInterpolation.LINEAR
 export(bool) var is_environment_aware:bool = false;
+# Events with a higher priority get their occlusion rays cast more often
+export(int) var occlusion_priority:int = 0
+# Furthest distance the event can be heard from, beyond it the position of the event is not sent to Wwise. Closer
+# positions are sent less often as the event gets further away, 0 sends every position
+export(float) var max_attenuation_radius:float = 0.0
 export(bool) var is_spatial:bool = false
 export(bool) var use_callback:bool = false
 
@@ -61,48 +66,6 @@ func get_listener() -> Spatial:
 	return get_tree().get_root().find_node("AkListener", true, false) as Spatial
 	# haaacky and slow, needs a better solution ^_^"
 	
-# Instantiating a RayCast node, setting it as child of the event's node. 
-# It is used in compute_occlusion to check if there is any object between Event 
-# and Listener.
-func set_up_raycast(_event:Spatial) -> RayCast:
-	var ray:RayCast = RayCast.new()
-	ray.enabled = true
-	ray.set_name("ray")
-	_event.add_child(ray)
-	ray.set_owner(_event)
-	return ray
-
-# Without using Spatial Audio, Wwise uses Physics.Raycast in the Unity integration
-# to check if there are any Objects between Event and Listener.
-# Then calls AK::SoundEngine::SetObjectObstructionAndOcclusion to set the obstruction
-# and occlusion values based on the number of objects hit. Here we are casting a ray
-# in the direction of the Listener and adding the OCCLUSION_ADDEND value to the occlusion
-# variable for each object between Event and Listener. 
-func compute_occlusion(listener_transform:Transform, source_transform:Transform, colliding_objects:Array, ray:RayCast) -> float:
-	colliding_objects.clear()
-	var occlusion_value:float = 0.0
-	ray.set_cast_to(listener_transform.origin - source_transform.origin)
-	while ray.is_colliding():
-		var obj = ray.get_collider()
-		if colliding_objects.find(obj) == -1:
-			colliding_objects.append(obj)
-		ray.add_exception(obj)
-		ray.force_raycast_update()
-		if colliding_objects.size() > 0:
-			occlusion_value += AkUtils.OCCLUSION_ADDEND
-	for obj in colliding_objects:
-		ray.remove_exception(obj)
-	return occlusion_value
-
-# Here we are actually calling AK::SoundEngine::SetObjectObstructionAndOcclusion.
-# Since it doesn't need to be every frame, we do that based on the value defined
-# in OCCLUSION_DETECTION_INTERVAL (milliseconds)
-func set_obstruction_and_occlusion(_event:Spatial, listener:Spatial, colliding_objects:Array, ray:RayCast, next_occlusion_update:int) -> void:
-	if OS.get_ticks_msec() >= next_occlusion_update:
-		next_occlusion_update = OS.get_ticks_msec() + AkUtils.OCCLUSION_DETECTION_INTERVAL
-		var current_occlusion:float = compute_occlusion(listener.get_global_transform(), self.get_global_transform(), colliding_objects, ray)
-		Wwise.set_obj_obstruction_and_occlusion(_event.get_instance_id(), listener.get_instance_id(), current_occlusion, current_occlusion)
-		
 func connect_signals(callback:int) -> void:
 		match(callback):
 			AkUtils.AkCallbackType.AK_EndOfEvent:
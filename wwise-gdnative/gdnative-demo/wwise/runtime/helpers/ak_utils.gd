@@ -93,6 +93,3 @@ enum GameEvent{
 	BODY_ENTER,
 	BODY_EXIT
 	}
-	
-const OCCLUSION_DETECTION_INTERVAL = 200
-const OCCLUSION_ADDEND = 0.25
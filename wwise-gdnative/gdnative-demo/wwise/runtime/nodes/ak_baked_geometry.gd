@@ -0,0 +1,6 @@
+extends Resource
+
+# Acoustic geometry welded at bake time, uploaded by Wwise.set_geometry_from_baked without any processing
+export(PoolByteArray) var data:PoolByteArray
+export(int) var vertex_count:int = 0
+export(int) var triangle_count:int = 0
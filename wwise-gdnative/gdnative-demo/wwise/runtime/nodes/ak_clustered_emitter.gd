@@ -0,0 +1,26 @@
+extends Spatial
+
+# Looping event played by this emitter. Nearby emitters playing the same event
+# are grouped natively into one game object with one position per emitter, so
+# many torches or machines cost a handful of voices.
+export(AK.EVENTS._enum) var event:int = AK.EVENTS._enum.values()[0]
+export(bool) var is_static:bool = true
+
+func _enter_tree() -> void:
+	if Engine.is_editor_hint():
+		return
+	#warning-ignore:return_value_discarded
+	Wwise.set_clustered_emitter(self, event, get_global_transform())
+	if not is_static:
+		set_notify_transform(true)
+
+func _exit_tree() -> void:
+	if Engine.is_editor_hint():
+		return
+	#warning-ignore:return_value_discarded
+	Wwise.remove_clustered_emitter(self)
+
+func _notification(notification:int) -> void:
+	if notification == NOTIFICATION_TRANSFORM_CHANGED:
+		#warning-ignore:return_value_discarded
+		Wwise.set_clustered_emitter(self, event, get_global_transform())
@@ -2,22 +2,27 @@ extends Area
 
 export(AK.AUX_BUSSES._enum) var aux_bus:int = AK.AUX_BUSSES._enum.values()[0]
 
+# Where environments overlap, the ones with the lowest priority are sent first
 export var env_priority = 0
+# Environment aware Events this far outside the box shapes still send to the aux bus, fading out towards the edge
+export(float) var fade_distance:float = 0.0
 
-func _ready():
-	#warning-ignore:return_value_discarded
-	self.connect("area_entered", self, "_on_area_enter")
-	#warning-ignore:return_value_discarded
-	self.connect("area_exited", self, "_on_area_exit")
+func _enter_tree() -> void:
+	add_environment_zones()
 
-func _on_area_enter(area):
-	var parent = area.get_parent()
-	if parent.get_class() == "AkEvent":
-		if parent.is_environment_aware:
-			parent.ak_environment_data.add_environment(self)
+func _exit_tree() -> void:
+	#warning-ignore:return_value_discarded
+	Wwise.remove_environment_zone(self)
 
-func _on_area_exit(area):
-	var parent = area.get_parent()
-	if parent.get_class() == "AkEvent":
-		if parent.is_environment_aware:
-			parent.ak_environment_data.remove_environment(self)
+# The box shapes of this Area are the zone of the Environment. The aux sends of
+# environment aware Events are computed natively from their position.
+func add_environment_zones() -> void:
+	for child in get_children():
+		if not child is CollisionShape or child.disabled:
+			continue
+		if child.shape is BoxShape:
+			#warning-ignore:return_value_discarded
+			Wwise.add_environment_zone(self, aux_bus, get_global_transform() * child.transform, child.shape.extents, 
+					env_priority, fade_distance)
+		else:
+			push_warning("AkEnvironment " + get_name() + " only uses BoxShape collision shapes as its zone")
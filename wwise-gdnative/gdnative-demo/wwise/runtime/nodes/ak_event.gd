@@ -1,9 +1,6 @@
 extends "res://wwise/runtime/helpers/ak_event_handler.gd"
 
 var listener:Spatial
-var ray:RayCast
-var colliding_objects:Array = []
-var ak_environment_data
 var playing_id:int
 
 func _init() -> void:
@@ -17,22 +14,27 @@ func _enter_tree() -> void:
 		return
 	self.set_process(true)
 		
+	if max_attenuation_radius > 0.0:
+		#warning-ignore:return_value_discarded
+		Wwise.set_game_obj_max_radius(self, max_attenuation_radius)
+		
 	if use_callback:
 		for flag in AkUtils.AkCallbackType.values().size():
 			if (callback_flag & AkUtils.AkCallbackType.values()[flag] > 0):
 				connect_signals(AkUtils.AkCallbackType.values()[flag])
 	
-	# If is_environment_aware is checked, Wwise.set_game_obj_aux_send_values will
-	# be called. Each Event will instantiate the AkGameObjeckEnvironmentData class,
-	# this instance holds an Array with currently active environments for this
-	# Event. Activate environments are added by AkEnvironment nodes themselves 
-	# (by checking if any Event is inside the Environment area). 
+	# If is_environment_aware is checked, the aux sends of this Event are
+	# computed natively from its position and the AkEnvironment zones around it,
+	# and only sent to Wwise when they change.
 	if is_environment_aware:
+		#warning-ignore:return_value_discarded
+		Wwise.set_game_obj_environment_aware(self, true)
 		listener = get_listener()
-		# This ray is used in set_obstruction_and_occlusion to check whether
-		# there are any objects between Event and Listener.
-		ray = set_up_raycast(self)
-		ak_environment_data = preload("res://wwise/runtime/helpers/ak_game_obj_environment_data.gd").new()
+		# Rays between Event and Listener are cast natively within a per-frame
+		# budget, and only changes in occlusion are sent to Wwise.
+		if listener:
+			#warning-ignore:return_value_discarded
+			Wwise.set_game_obj_occlusion(self, listener, occlusion_priority)
 		
 func handle_game_event(game_event:int) -> void:
 	if trigger_on == game_event:
@@ -51,13 +53,11 @@ func stop_event() -> void:
 		
 func _process(_delta) -> void:
 	Wwise.set_3d_position(self, get_global_transform())
-	
-	if is_environment_aware:
-		ak_environment_data.update_aux_send(self, self.get_global_transform().origin)
-	
-func _physics_process(_delta) -> void:
-		if listener and is_environment_aware:
-			set_obstruction_and_occlusion(self, listener, colliding_objects, ray, 0)
+
+func _exit_tree() -> void:
+	if listener:
+		#warning-ignore:return_value_discarded
+		Wwise.remove_game_obj_occlusion(self)
 
 func get_class() -> String:
 	return "AkEvent"
@@ -1,15 +1,24 @@
 extends Spatial
 
-var vertices:Array = []
-var triangles:Array= []
 var mesh_instance:MeshInstance
 
 export(bool) var is_static:bool = true
+# Welds the mesh on the geometry thread, it is registered a few frames later instead of stalling _enter_tree
+export(bool) var load_async:bool = false
 export(bool) var enable_diffraction:bool = false
 export(bool) var enable_diffraction_on_boundary_edges:bool = false
 export(Resource) var acoustic_texture:Resource
+# One acoustic texture per mesh surface, empty entries use the acoustic_texture metadata of the surface material and
+# then acoustic_texture
+export(Array, Resource) var surface_acoustic_textures:Array = []
 export(float) var occlusion_value:float = 1.0
 export(NodePath) var room:NodePath
+# Decimates the mesh down to this many triangles, 0 keeps every triangle the error allows
+export(int) var simplify_target_triangles:int = 0
+# Furthest a vertex can move from the original surface when simplifying, 0 leaves the mesh as is unless a target is set
+export(float) var simplify_max_error:float = 0.0
+# Set by Project > Tools > Bake Acoustic Geometry, used instead of reading the mesh when present
+export(Resource) var baked_geometry:Resource
 var room_node:Node
 
 func _enter_tree() -> void:
@@ -24,43 +33,27 @@ func _exit_tree() -> void:
 	
 func _notification(notification:int) -> void:
 	if(notification == NOTIFICATION_TRANSFORM_CHANGED):
-		if Wwise.remove_geometry(self):
-			#warning-ignore:return_value_discarded
-			set_geometry(mesh_instance)
+		# Only the cached vertices are moved, the mesh is not read or welded again
+		#warning-ignore:return_value_discarded
+		Wwise.set_geometry_transform(self, get_global_transform())
 
-func create_mesh_data_tool(mesh:Mesh) -> MeshDataTool:
-	var array_mesh = mesh
-	if !array_mesh is ArrayMesh:
-		var surface_arrays = mesh.surface_get_arrays(0)
-		array_mesh = ArrayMesh.new()
-		array_mesh.add_surface_from_arrays(Mesh.PRIMITIVE_TRIANGLES, surface_arrays)
-	var mesh_data_tool = MeshDataTool.new()
-	mesh_data_tool.create_from_surface(array_mesh, 0)
-	return mesh_data_tool
-	
 func set_geometry(mesh_inst:MeshInstance) -> bool:
-	var mdt = create_mesh_data_tool(mesh_inst.mesh)
-		
-	for i in range(mdt.get_vertex_count()):
-		var vertex = to_global(mdt.get_vertex(i))
-		vertices.append(vertex)
-	
-	for i in range(mdt.get_face_count()):
-		var point_0 = mdt.get_face_vertex(i, 0)
-		var point_1 = mdt.get_face_vertex(i, 1)
-		var point_2 = mdt.get_face_vertex(i, 2)
-		triangles.append(point_0)
-		triangles.append(point_1)
-		triangles.append(point_2)
-	
 	if not room.is_empty():
 		room_node = get_node(room)
 	
-	var result = Wwise.set_geometry(vertices, triangles, acoustic_texture, occlusion_value, self, enable_diffraction, enable_diffraction_on_boundary_edges, room_node)
-	
-	vertices.clear()
-	triangles.clear()
+	if baked_geometry:
+		return Wwise.set_geometry_from_baked(baked_geometry.data, get_global_transform(), acoustic_texture, 
+				surface_acoustic_textures, occlusion_value, self, enable_diffraction, 
+				enable_diffraction_on_boundary_edges, room_node)
 	
-	return result
-	
-
+	#warning-ignore:return_value_discarded
+	Wwise.set_geometry_simplification(self, simplify_target_triangles, simplify_max_error)
+	if load_async:
+		return Wwise.set_geometry_from_mesh_async(mesh_inst.mesh, get_global_transform(), acoustic_texture, 
+				surface_acoustic_textures, occlusion_value, self, enable_diffraction, 
+				enable_diffraction_on_boundary_edges, room_node)
+	
+	# The surfaces are read and transformed natively, vertices end up in world space as with to_global
+	return Wwise.set_geometry_from_mesh(mesh_inst.mesh, get_global_transform(), acoustic_texture, 
+			surface_acoustic_textures, occlusion_value, self, enable_diffraction, 
+			enable_diffraction_on_boundary_edges, room_node)
@@ -37,6 +37,8 @@ func _add_common_user_settings():
 				PROPERTY_HINT_NONE, "")
 	_add_setting(WWISE_COMMON_USER_SETTINGS_PATH + "engine_logging", 0, TYPE_BOOL, 
 				PROPERTY_HINT_NONE, "")
+	_add_setting(WWISE_COMMON_USER_SETTINGS_PATH + "server_mode", 0, TYPE_BOOL, 
+				PROPERTY_HINT_NONE, "")
 	_add_setting(WWISE_COMMON_USER_SETTINGS_PATH + "maximum_number_of_positioning_paths", 255, TYPE_INT, 
 				PROPERTY_HINT_NONE, "")
 	_add_setting(WWISE_COMMON_USER_SETTINGS_PATH + "command_queue_size", 262144, TYPE_INT, 
@@ -62,6 +64,10 @@ func _add_common_user_settings():
 				PROPERTY_HINT_ENUM, "16000, 24000, 32000, 44100, 48000")
 	_add_setting(WWISE_COMMON_USER_SETTINGS_PATH + "number_of_refills_in_voice", 1, TYPE_INT, 
 				PROPERTY_HINT_ENUM, "2, 4")
+	_add_setting(WWISE_COMMON_USER_SETTINGS_PATH + "render_tick_mode", 0, TYPE_INT, 
+				PROPERTY_HINT_ENUM, "Render Frame, Physics Frame, Fixed Rate Thread")
+	_add_setting(WWISE_COMMON_USER_SETTINGS_PATH + "render_tick_rate", 0.0, TYPE_REAL, 
+				PROPERTY_HINT_RANGE, "0.0, 1000.0")
 	
 	_add_setting(WWISE_COMMON_USER_SETTINGS_SPATIAL_AUDIO_PATH + "max_sound_propagation_depth",	
 				8.0, TYPE_REAL, PROPERTY_HINT_RANGE, "0.0,8.0")
@@ -108,6 +114,47 @@ func _add_common_advanced_settings():
 				2.0, TYPE_REAL, PROPERTY_HINT_RANGE, "1.0,3.0")
 	_add_setting(WWISE_COMMON_ADVANCED_SETTINGS_PATH + "spatial_audio/diffraction_shadow_degrees", 
 				30.0, TYPE_REAL, PROPERTY_HINT_RANGE, "0.1,180.0")
+	_add_setting(WWISE_COMMON_ADVANCED_SETTINGS_PATH + "spatial_audio/geometry_weld_tolerance", 
+				0.001, TYPE_REAL, PROPERTY_HINT_RANGE, "0.0,1.0,0.0001")
+	_add_setting(WWISE_COMMON_ADVANCED_SETTINGS_PATH + "spatial_audio/geometry_commits_per_frame", 
+				4, TYPE_INT, PROPERTY_HINT_RANGE, "0,64")
+	_add_setting(WWISE_COMMON_ADVANCED_SETTINGS_PATH + "spatial_audio/occlusion_rays_per_frame", 
+				8, TYPE_INT, PROPERTY_HINT_RANGE, "0,256")
+	_add_setting(WWISE_COMMON_ADVANCED_SETTINGS_PATH + "spatial_audio/occlusion_smoothing_time", 
+				0.1, TYPE_REAL, PROPERTY_HINT_RANGE, "0.0,2.0,0.01")
+	_add_setting(WWISE_COMMON_ADVANCED_SETTINGS_PATH + "spatial_audio/occlusion_per_hit", 
+				0.25, TYPE_REAL, PROPERTY_HINT_RANGE, "0.0,1.0,0.01")
+	_add_setting(WWISE_COMMON_ADVANCED_SETTINGS_PATH + "spatial_audio/occlusion_collision_mask", 
+				1048575, TYPE_INT, PROPERTY_HINT_LAYERS_3D_PHYSICS, "")
+
+	_add_setting(WWISE_COMMON_ADVANCED_SETTINGS_PATH + "emitter_lod/full_rate_distance_ratio", 
+				0.5, TYPE_REAL, PROPERTY_HINT_RANGE, "0.0,1.0,0.01")
+	_add_setting(WWISE_COMMON_ADVANCED_SETTINGS_PATH + "emitter_lod/reduced_update_interval", 
+				4, TYPE_INT, PROPERTY_HINT_RANGE, "1,60")
+	_add_setting(WWISE_COMMON_ADVANCED_SETTINGS_PATH + "emitter_lod/resume_margin", 
+				5.0, TYPE_REAL, PROPERTY_HINT_RANGE, "0.0,100.0,0.1")
+	_add_setting(WWISE_COMMON_ADVANCED_SETTINGS_PATH + "emitter_lod/hysteresis", 
+				0.1, TYPE_REAL, PROPERTY_HINT_RANGE, "0.0,1.0,0.01")
+
+	_add_setting(WWISE_COMMON_ADVANCED_SETTINGS_PATH + "emitter_clusters/cluster_radius", 
+				10.0, TYPE_REAL, PROPERTY_HINT_RANGE, "0.0,1000.0,0.1")
+	_add_setting(WWISE_COMMON_ADVANCED_SETTINGS_PATH + "emitter_clusters/max_clusters", 
+				32, TYPE_INT, PROPERTY_HINT_RANGE, "1,1024")
+
+	_add_setting(WWISE_COMMON_ADVANCED_SETTINGS_PATH + "transient_game_objects/pool_size", 
+				64, TYPE_INT, PROPERTY_HINT_RANGE, "0,4096")
+	_add_setting(WWISE_COMMON_ADVANCED_SETTINGS_PATH + "transient_game_objects/max_pool_size", 
+				256, TYPE_INT, PROPERTY_HINT_RANGE, "0,4096")
+
+	_add_setting(WWISE_COMMON_ADVANCED_SETTINGS_PATH + "memory/use_pool_allocator", 
+				0, TYPE_BOOL, PROPERTY_HINT_NONE, "")
+	_add_setting(WWISE_COMMON_ADVANCED_SETTINGS_PATH + "memory/pool_budget_mb", 
+				128, TYPE_INT, PROPERTY_HINT_RANGE, "8,4096")
+
+	_add_setting(WWISE_COMMON_ADVANCED_SETTINGS_PATH + "offline_rendering/enabled", 
+				0, TYPE_BOOL, PROPERTY_HINT_NONE, "")
+	_add_setting(WWISE_COMMON_ADVANCED_SETTINGS_PATH + "offline_rendering/frame_time", 
+				0.0, TYPE_REAL, PROPERTY_HINT_RANGE, "0.0,1.0,0.001")
 
 # TODO: the following three settings are not yet implemented
 	_add_setting(WWISE_COMMON_ADVANCED_SETTINGS_PATH + "render_during_focus_loss", 
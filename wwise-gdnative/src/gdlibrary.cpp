@@ -1,4 +1,5 @@
 #include "wwise_gdnative.h"
+#include "wwise_geometry_baker.h"
 
 extern "C" void GDN_EXPORT wwise_gdnative_init(godot_gdnative_init_options* o)
 {
@@ -14,4 +15,5 @@ extern "C" void GDN_EXPORT wwise_nativescript_init(void* handle)
 {
 	godot::Godot::nativescript_init(handle);
 	godot::register_class<godot::Wwise>();
+	godot::register_tool_class<godot::WwiseGeometryBaker>();
 }
\ No newline at end of file
@@ -0,0 +1,344 @@
+#if defined(WWISE_BENCHMARKS)
+
+#include "wwise_benchmarks.h"
+#include "wwise_gdnative.h"
+
+#include <Array.hpp>
+#include <Directory.hpp>
+#include <File.hpp>
+#include <PoolArrays.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+using namespace godot;
+
+namespace
+{
+// Commands are flushed with RenderAudio between batches so the command queue never fills up while being timed
+const int COMMAND_BATCH_SIZE = 256;
+const int DEFAULT_ITERATIONS = 10000;
+const int DEFAULT_FILE_SIZE = 8 * 1024 * 1024;
+const char* DEFAULT_FILE_PATH = "user://wwise_benchmark_io.bin";
+const int GEOMETRY_GRID_SIZES[] = {8, 16, 32, 64, 128};
+const int GEOMETRY_REPEATS = 4;
+const int FILE_READ_BLOCK_SIZES[] = {16 * 1024, 64 * 1024, 256 * 1024};
+} // namespace
+
+Dictionary WwiseBenchmarks::run(Wwise& wwise, const Dictionary options)
+{
+	Dictionary results;
+
+	if (wwise.serverMode)
+	{
+		Godot::print_warning("Benchmarks need the sound engine, they are not available in server mode", __FUNCTION__,
+							 __FILE__, __LINE__);
+		return results;
+	}
+
+	const int iterations = options.has("iterations") ? static_cast<int>(options["iterations"]) : DEFAULT_ITERATIONS;
+	const unsigned int eventID = options.has("event_id") ? static_cast<unsigned int>(options["event_id"]) : 0;
+	const int fileSize = options.has("file_size") ? static_cast<int>(options["file_size"]) : DEFAULT_FILE_SIZE;
+	String filePath = DEFAULT_FILE_PATH;
+
+	if (options.has("file_path"))
+	{
+		filePath = options["file_path"];
+	}
+
+	Node* gameObject = Node::_new();
+	wwise.registerGameObject(gameObject, "Benchmark");
+
+	if (eventID != AK_INVALID_UNIQUE_ID)
+	{
+		results["post_event"] = benchmarkPostEvent(wwise, gameObject, eventID, iterations);
+	}
+	else
+	{
+		Godot::print_warning("No event_id given, skipping the post_event benchmark", __FUNCTION__, __FILE__,
+							 __LINE__);
+	}
+
+	results["set_3d_position"] = benchmarkSet3DPosition(wwise, gameObject, iterations);
+	results["event_callback"] = benchmarkEventCallback(wwise, gameObject, iterations);
+	results["set_geometry"] = benchmarkSetGeometry(wwise, gameObject);
+	results["file_read"] = benchmarkFileRead(filePath, fileSize);
+
+	wwise.unregisterGameObject(gameObject);
+	wwise.renderAudio();
+	gameObject->free();
+
+	return results;
+}
+
+Dictionary WwiseBenchmarks::benchmarkPostEvent(Wwise& wwise, Node* gameObject, const unsigned int eventID,
+											   const int iterations)
+{
+	int64_t totalNsec = 0;
+	int failedPosts = 0;
+
+	for (int first = 0; first < iterations; first += COMMAND_BATCH_SIZE)
+	{
+		const int batchSize = std::min(COMMAND_BATCH_SIZE, iterations - first);
+		const int64_t startNsec = nowNsec();
+
+		for (int i = 0; i < batchSize; ++i)
+		{
+			if (wwise.postEventID(eventID, gameObject) == AK_INVALID_PLAYING_ID)
+			{
+				++failedPosts;
+			}
+		}
+
+		totalNsec += nowNsec() - startNsec;
+
+		AK::SoundEngine::StopAll(static_cast<AkGameObjectID>(gameObject->get_instance_id()));
+		wwise.renderAudio();
+	}
+
+	Dictionary result = makeResult(iterations, totalNsec);
+	result["failed"] = failedPosts;
+
+	return result;
+}
+
+Dictionary WwiseBenchmarks::benchmarkSet3DPosition(Wwise& wwise, Node* gameObject, const int iterations)
+{
+	int64_t totalNsec = 0;
+
+	for (int first = 0; first < iterations; first += COMMAND_BATCH_SIZE)
+	{
+		const int batchSize = std::min(COMMAND_BATCH_SIZE, iterations - first);
+		const int64_t startNsec = nowNsec();
+
+		for (int i = 0; i < batchSize; ++i)
+		{
+			const real_t offset = static_cast<real_t>(first + i) * 0.01f;
+			wwise.set3DPosition(gameObject, Transform(Basis(), Vector3(offset, 0.0f, -offset)));
+		}
+
+		totalNsec += nowNsec() - startNsec;
+
+		wwise.renderAudio();
+	}
+
+	return makeResult(iterations, totalNsec);
+}
+
+Dictionary WwiseBenchmarks::benchmarkEventCallback(Wwise& wwise, Node* gameObject, const int iterations)
+{
+	int64_t enqueueNsec = 0;
+	int64_t emitNsec = 0;
+
+	AkEventCallbackInfo callbackInfo;
+	callbackInfo.pCookie = nullptr;
+	callbackInfo.gameObjID = static_cast<AkGameObjectID>(gameObject->get_instance_id());
+	callbackInfo.eventID = 1;
+
+	// Batches stay well under the signal queue size so no callback is dropped
+	for (int first = 0; first < iterations; first += COMMAND_BATCH_SIZE)
+	{
+		const int batchSize = std::min(COMMAND_BATCH_SIZE, iterations - first);
+		const int64_t enqueueStartNsec = nowNsec();
+
+		for (int i = 0; i < batchSize; ++i)
+		{
+			callbackInfo.playingID = static_cast<AkPlayingID>(first + i + 1);
+			Wwise::eventCallback(AK_EndOfEvent, &callbackInfo);
+		}
+
+		const int64_t emitStartNsec = nowNsec();
+		wwise.emitSignals();
+		const int64_t emitEndNsec = nowNsec();
+
+		enqueueNsec += emitStartNsec - enqueueStartNsec;
+		emitNsec += emitEndNsec - emitStartNsec;
+	}
+
+	Dictionary result = makeResult(iterations, enqueueNsec + emitNsec);
+	result["enqueue_per_call_ns"] = iterations > 0 ? static_cast<float>(enqueueNsec) / iterations : 0.0f;
+	result["emit_per_call_ns"] = iterations > 0 ? static_cast<float>(emitNsec) / iterations : 0.0f;
+
+	return result;
+}
+
+Dictionary WwiseBenchmarks::benchmarkSetGeometry(Wwise& wwise, Node* gameObject)
+{
+	Array results;
+
+	for (const int gridSize : GEOMETRY_GRID_SIZES)
+	{
+		// A flat grid of gridSize x gridSize quads, each vertex is shared by up to six triangles
+		PoolVector3Array vertices;
+		PoolIntArray triangles;
+
+		for (int z = 0; z <= gridSize; ++z)
+		{
+			for (int x = 0; x <= gridSize; ++x)
+			{
+				vertices.append(Vector3(static_cast<real_t>(x), 0.0f, static_cast<real_t>(z)));
+			}
+		}
+
+		for (int z = 0; z < gridSize; ++z)
+		{
+			for (int x = 0; x < gridSize; ++x)
+			{
+				const int corner = z * (gridSize + 1) + x;
+
+				triangles.append(corner);
+				triangles.append(corner + gridSize + 1);
+				triangles.append(corner + 1);
+				triangles.append(corner + 1);
+				triangles.append(corner + gridSize + 1);
+				triangles.append(corner + gridSize + 2);
+			}
+		}
+
+		int64_t setNsec = 0;
+		int64_t removeNsec = 0;
+
+		for (int repeat = 0; repeat < GEOMETRY_REPEATS; ++repeat)
+		{
+			const int64_t setStartNsec = nowNsec();
+			wwise.setGeometry(vertices, triangles, nullptr, 1.0f, gameObject, false, false, nullptr);
+			const int64_t removeStartNsec = nowNsec();
+			wwise.removeGeometry(gameObject);
+			const int64_t removeEndNsec = nowNsec();
+
+			setNsec += removeStartNsec - setStartNsec;
+			removeNsec += removeEndNsec - removeStartNsec;
+
+			wwise.renderAudio();
+		}
+
+		Dictionary result;
+		result["vertices"] = vertices.size();
+		result["triangles"] = triangles.size() / 3;
+		result["set_ms"] = static_cast<float>(setNsec) / GEOMETRY_REPEATS / 1000000.0f;
+		result["remove_ms"] = static_cast<float>(removeNsec) / GEOMETRY_REPEATS / 1000000.0f;
+
+		results.append(result);
+	}
+
+	Dictionary result;
+	result["grids"] = results;
+
+	return result;
+}
+
+Dictionary WwiseBenchmarks::benchmarkFileRead(const String path, const int fileSize)
+{
+	Dictionary result;
+	Array results;
+
+	if (fileSize <= 0)
+	{
+		return result;
+	}
+
+	File* file = File::_new();
+
+	if (file->open(path, File::WRITE) != Error::OK)
+	{
+		Godot::print_error("Failed to create " + path, __FUNCTION__, __FILE__, __LINE__);
+		file->free();
+		return result;
+	}
+
+	PoolByteArray chunk;
+	chunk.resize(std::min(fileSize, 1024 * 1024));
+
+	{
+		PoolByteArray::Write chunkWrite = chunk.write();
+
+		for (int i = 0; i < chunk.size(); ++i)
+		{
+			chunkWrite[i] = static_cast<uint8_t>(i);
+		}
+	}
+
+	for (int written = 0; written < fileSize; written += chunk.size())
+	{
+		file->store_buffer(chunk);
+	}
+
+	file->close();
+	file->free();
+
+	// A standalone device is enough to exercise Open/Read/Close, it is never registered with the stream manager
+	CAkIOHookBlockingGodot blockingDevice;
+	std::vector<uint8_t> buffer;
+
+	for (const int blockSize : FILE_READ_BLOCK_SIZES)
+	{
+		AkFileDesc fileDesc;
+
+		if (blockingDevice.Open(path, AK_OpenModeRead, fileDesc) != AK_Success)
+		{
+			Godot::print_error("Failed to open " + path, __FUNCTION__, __FILE__, __LINE__);
+			break;
+		}
+
+		buffer.resize(blockSize);
+
+		AkIoHeuristics heuristics{};
+		AkIOTransferInfo transferInfo{};
+		int reads = 0;
+
+		const int64_t startNsec = nowNsec();
+
+		for (AkInt64 position = 0; position < fileDesc.iFileSize; position += blockSize)
+		{
+			transferInfo.uFilePosition = static_cast<AkUInt64>(position);
+			transferInfo.uBufferSize = static_cast<AkUInt32>(blockSize);
+			transferInfo.uRequestedSize =
+				static_cast<AkUInt32>(std::min<AkInt64>(blockSize, fileDesc.iFileSize - position));
+
+			blockingDevice.Read(fileDesc, heuristics, buffer.data(), transferInfo);
+			++reads;
+		}
+
+		const int64_t totalNsec = nowNsec() - startNsec;
+
+		blockingDevice.Close(fileDesc);
+
+		Dictionary blockResult = makeResult(reads, totalNsec);
+		blockResult["block_size"] = blockSize;
+		blockResult["megabytes_per_second"] =
+			totalNsec > 0 ? static_cast<float>(fileDesc.iFileSize) / (1024.0f * 1024.0f) / (totalNsec / 1e9f) : 0.0f;
+
+		results.append(blockResult);
+	}
+
+	Directory* directory = Directory::_new();
+	directory->remove(path);
+	directory->free();
+
+	result["file_size"] = fileSize;
+	result["blocks"] = results;
+
+	return result;
+}
+
+Dictionary WwiseBenchmarks::makeResult(const int iterations, const int64_t totalNsec)
+{
+	Dictionary result;
+
+	result["iterations"] = iterations;
+	result["total_ms"] = static_cast<float>(totalNsec) / 1000000.0f;
+	result["per_call_ns"] = iterations > 0 ? static_cast<float>(totalNsec) / iterations : 0.0f;
+	result["calls_per_second"] = totalNsec > 0 ? static_cast<float>(iterations) / (totalNsec / 1e9f) : 0.0f;
+
+	return result;
+}
+
+int64_t WwiseBenchmarks::nowNsec()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			   std::chrono::steady_clock::now().time_since_epoch())
+		.count();
+}
+
+#endif
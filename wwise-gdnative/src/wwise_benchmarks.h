@@ -0,0 +1,39 @@
+#ifndef WWISE_BENCHMARKS_H
+#define WWISE_BENCHMARKS_H
+
+#if defined(WWISE_BENCHMARKS)
+
+#include <Dictionary.hpp>
+#include <Node.hpp>
+#include <String.hpp>
+
+#include <cstdint>
+
+namespace godot
+{
+class Wwise;
+
+// Microbenchmarks for the integration hot paths, only compiled in with scons benchmarks=yes. They run against the
+// live sound engine so the timings include the real Godot and Wwise calls, results are returned as a Dictionary
+// that the runner scene writes out as JSON.
+class WwiseBenchmarks
+{
+  public:
+	static Dictionary run(Wwise& wwise, const Dictionary options);
+
+  private:
+	static Dictionary benchmarkPostEvent(Wwise& wwise, Node* gameObject, const unsigned int eventID,
+										 const int iterations);
+	static Dictionary benchmarkSet3DPosition(Wwise& wwise, Node* gameObject, const int iterations);
+	static Dictionary benchmarkEventCallback(Wwise& wwise, Node* gameObject, const int iterations);
+	static Dictionary benchmarkSetGeometry(Wwise& wwise, Node* gameObject);
+	static Dictionary benchmarkFileRead(const String path, const int fileSize);
+
+	static Dictionary makeResult(const int iterations, const int64_t totalNsec);
+	static int64_t nowNsec();
+};
+} // namespace godot
+
+#endif
+
+#endif
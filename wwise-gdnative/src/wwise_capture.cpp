@@ -0,0 +1,202 @@
+#include "wwise_capture.h"
+
+#include <algorithm>
+#include <thread>
+
+using namespace godot;
+
+std::vector<float> WwiseOutputCapture::samples;
+uint32_t WwiseOutputCapture::numChannels = 0;
+uint32_t WwiseOutputCapture::sampleRate = 0;
+uint64_t WwiseOutputCapture::capacityFrames = 0;
+AkOutputDeviceID WwiseOutputCapture::outputID = AK_INVALID_OUTPUT_DEVICE_ID;
+bool WwiseOutputCapture::registered = false;
+
+std::atomic<bool> WwiseOutputCapture::capturing{false};
+std::atomic<int> WwiseOutputCapture::activeWriters{0};
+std::atomic<uint64_t> WwiseOutputCapture::writeFrame{0};
+std::atomic<uint64_t> WwiseOutputCapture::readFrame{0};
+std::atomic<uint64_t> WwiseOutputCapture::capturedFrames{0};
+std::atomic<uint64_t> WwiseOutputCapture::droppedFrames{0};
+
+bool WwiseOutputCapture::start(const float seconds)
+{
+	stop();
+
+	if (!AK::SoundEngine::IsInitialized() || seconds <= 0.0f)
+	{
+		return false;
+	}
+
+	outputID = AK::SoundEngine::GetOutputID(AK_INVALID_UNIQUE_ID, 0);
+	numChannels = AK::SoundEngine::GetSpeakerConfiguration(outputID).uNumChannels;
+	sampleRate = AK::SoundEngine::GetSampleRate();
+
+	if (numChannels == 0 || sampleRate == 0)
+	{
+		return false;
+	}
+
+	capacityFrames = std::max<uint64_t>(1, static_cast<uint64_t>(seconds * sampleRate));
+	samples.assign(static_cast<size_t>(capacityFrames * numChannels), 0.0f);
+
+	writeFrame = 0;
+	readFrame = 0;
+	capturedFrames = 0;
+	droppedFrames = 0;
+
+	capturing = true;
+
+	if (AK::SoundEngine::RegisterCaptureCallback(captureCallback, outputID) != AK_Success)
+	{
+		capturing = false;
+		return false;
+	}
+
+	registered = true;
+	return true;
+}
+
+void WwiseOutputCapture::stop()
+{
+	if (!registered)
+	{
+		return;
+	}
+
+	AK::SoundEngine::UnregisterCaptureCallback(captureCallback, outputID);
+	registered = false;
+
+	// The callback may still be running on the audio thread, the samples stay readable once it has returned
+	capturing = false;
+
+	while (activeWriters != 0)
+	{
+		std::this_thread::yield();
+	}
+}
+
+bool WwiseOutputCapture::isCapturing()
+{
+	return capturing;
+}
+
+PoolRealArray WwiseOutputCapture::readFrames(const int maxFrames)
+{
+	uint64_t firstFrame = 0;
+	const uint64_t numFrames = acquireReadableFrames(maxFrames, firstFrame);
+
+	PoolRealArray frames;
+	frames.resize(static_cast<int>(numFrames * numChannels));
+
+	{
+		PoolRealArray::Write framesWrite = frames.write();
+
+		for (uint64_t frame = 0; frame < numFrames; ++frame)
+		{
+			const float* source = &samples[((firstFrame + frame) % capacityFrames) * numChannels];
+			std::copy(source, source + numChannels, framesWrite.ptr() + frame * numChannels);
+		}
+	}
+
+	readFrame.store(firstFrame + numFrames, std::memory_order_release);
+
+	return frames;
+}
+
+PoolByteArray WwiseOutputCapture::readFramesPCM16(const int maxFrames)
+{
+	uint64_t firstFrame = 0;
+	const uint64_t numFrames = acquireReadableFrames(maxFrames, firstFrame);
+
+	PoolByteArray bytes;
+	bytes.resize(static_cast<int>(numFrames * numChannels * sizeof(int16_t)));
+
+	{
+		PoolByteArray::Write bytesWrite = bytes.write();
+		uint8_t* out = bytesWrite.ptr();
+
+		for (uint64_t frame = 0; frame < numFrames; ++frame)
+		{
+			const float* source = &samples[((firstFrame + frame) % capacityFrames) * numChannels];
+
+			for (uint32_t channel = 0; channel < numChannels; ++channel)
+			{
+				const float sample = std::min(std::max(source[channel], -1.0f), 1.0f);
+				const int16_t value = static_cast<int16_t>(sample * 32767.0f);
+
+				// Little endian, as expected by AudioStreamSample
+				*out++ = static_cast<uint8_t>(value & 0xFF);
+				*out++ = static_cast<uint8_t>((value >> 8) & 0xFF);
+			}
+		}
+	}
+
+	readFrame.store(firstFrame + numFrames, std::memory_order_release);
+
+	return bytes;
+}
+
+Dictionary WwiseOutputCapture::getInfo()
+{
+	uint64_t firstFrame = 0;
+	const uint64_t availableFrames = acquireReadableFrames(0, firstFrame);
+
+	Dictionary info;
+
+	info["capturing"] = isCapturing();
+	info["channels"] = static_cast<unsigned int>(numChannels);
+	info["sample_rate"] = static_cast<unsigned int>(sampleRate);
+	info["capacity_frames"] = static_cast<int64_t>(capacityFrames);
+	info["available_frames"] = static_cast<int64_t>(availableFrames);
+	info["captured_frames"] = static_cast<int64_t>(capturedFrames.load());
+	info["dropped_frames"] = static_cast<int64_t>(droppedFrames.load());
+
+	return info;
+}
+
+void WwiseOutputCapture::captureCallback(AkAudioBuffer& in_CaptureBuffer, AkOutputDeviceID in_idOutput,
+										 void* in_pCookie)
+{
+	// Registering as a writer before checking the flag lets stop() wait for this call to return
+	++activeWriters;
+
+	if (capturing)
+	{
+		const uint64_t numFrames = in_CaptureBuffer.uValidFrames;
+		const uint64_t firstFrame = writeFrame.load(std::memory_order_relaxed);
+		const uint64_t freeFrames = capacityFrames - (firstFrame - readFrame.load(std::memory_order_acquire));
+		const uint64_t framesToWrite = std::min(numFrames, freeFrames);
+		const uint32_t bufferChannels = in_CaptureBuffer.NumChannels();
+
+		for (uint32_t channel = 0; channel < numChannels; ++channel)
+		{
+			const AkSampleType* source = channel < bufferChannels ? in_CaptureBuffer.GetChannel(channel) : nullptr;
+
+			for (uint64_t frame = 0; frame < framesToWrite; ++frame)
+			{
+				samples[((firstFrame + frame) % capacityFrames) * numChannels + channel] =
+					source ? static_cast<float>(source[frame]) : 0.0f;
+			}
+		}
+
+		writeFrame.store(firstFrame + framesToWrite, std::memory_order_release);
+		capturedFrames.fetch_add(numFrames, std::memory_order_relaxed);
+		droppedFrames.fetch_add(numFrames - framesToWrite, std::memory_order_relaxed);
+	}
+
+	--activeWriters;
+}
+
+uint64_t WwiseOutputCapture::acquireReadableFrames(const int maxFrames, uint64_t& out_readFrame)
+{
+	out_readFrame = readFrame.load(std::memory_order_relaxed);
+	const uint64_t availableFrames = writeFrame.load(std::memory_order_acquire) - out_readFrame;
+
+	if (maxFrames > 0)
+	{
+		return std::min(availableFrames, static_cast<uint64_t>(maxFrames));
+	}
+
+	return availableFrames;
+}
@@ -0,0 +1,50 @@
+#ifndef WWISE_CAPTURE_H
+#define WWISE_CAPTURE_H
+
+#include <Dictionary.hpp>
+#include <PoolArrays.hpp>
+#include <AK/SoundEngine/Common/AkSoundEngine.h>
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace godot
+{
+// Taps the main output mix into a single producer, single consumer ring buffer of interleaved float samples. The
+// audio thread only copies samples and publishes an atomic index, frames that do not fit are dropped and counted.
+class WwiseOutputCapture
+{
+  public:
+	// Starts a new capture that can hold the given duration of audio before frames are dropped
+	static bool start(const float seconds);
+	static void stop();
+	static bool isCapturing();
+
+	// Removes and returns up to maxFrames interleaved frames, 0 reads everything available
+	static PoolRealArray readFrames(const int maxFrames);
+	static PoolByteArray readFramesPCM16(const int maxFrames);
+
+	static Dictionary getInfo();
+
+  private:
+	static void captureCallback(AkAudioBuffer& in_CaptureBuffer, AkOutputDeviceID in_idOutput, void* in_pCookie);
+	static uint64_t acquireReadableFrames(const int maxFrames, uint64_t& out_readFrame);
+
+	static std::vector<float> samples;
+	static uint32_t numChannels;
+	static uint32_t sampleRate;
+	static uint64_t capacityFrames;
+	static AkOutputDeviceID outputID;
+	static bool registered;
+
+	static std::atomic<bool> capturing;
+	static std::atomic<int> activeWriters;
+	static std::atomic<uint64_t> writeFrame;
+	static std::atomic<uint64_t> readFrame;
+	static std::atomic<uint64_t> capturedFrames;
+	static std::atomic<uint64_t> droppedFrames;
+};
+} // namespace godot
+
+#endif
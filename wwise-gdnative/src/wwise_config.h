@@ -0,0 +1,115 @@
+#ifndef WWISE_CONFIG_H
+#define WWISE_CONFIG_H
+
+#include <String.hpp>
+#include <AK/SoundEngine/Common/AkTypes.h>
+
+namespace godot
+{
+// Typed snapshot of the Wwise project settings. It is filled once at startup so that initialisation does not go
+// through ProjectSettings for every value it needs.
+struct WwiseConfig
+{
+	// Common user settings
+	String basePath;
+	String startupLanguage;
+	int callbackManagerBufferSize = 4096;
+	bool engineLogging = false;
+	bool loadInitBankAtStartup = false;
+	String audioDeviceShareset;
+	unsigned int channelConfigType = 0;
+	unsigned int numberOfChannels = 0;
+	unsigned int deviceID = 0;
+	unsigned int panningRule = 0;
+	unsigned int commandQueueSize = 0;
+	unsigned int maximumNumberOfPositioningPaths = 0;
+	unsigned int samplesPerFrame = 0;
+	unsigned int numberOfRefillsInVoice = 0;
+	unsigned int sampleRate = 0;
+	float streamingLookAheadRatio = 0.0f;
+	bool serverMode = false;
+	unsigned int renderTickMode = 0;
+	// Ticks per second of the fixed rate render thread, 0 ticks once per audio frame
+	float renderTickRate = 0.0f;
+
+	// Common advanced settings
+	bool useStreamCache = false;
+	float targetAutoStreamBufferLengthMs = 0.0f;
+	unsigned int ioMemorySize = 0;
+	unsigned int maximumPinnedBytesInCache = 0;
+	bool debugOutOfRangeCheckEnabled = false;
+	bool enableGameSyncPreparation = false;
+	float debugOutOfRangeLimit = 0.0f;
+	unsigned int continuousPlaybackLookAhead = 0;
+	unsigned int maximumHardwareTimeoutMs = 0;
+	unsigned int monitorQueuePoolSize = 0;
+	bool usePoolAllocator = false;
+	unsigned int poolBudgetMB = 0;
+	bool offlineRendering = false;
+	// Seconds of audio rendered per RenderAudio call when rendering offline, 0 renders one audio frame
+	float offlineRenderingFrameTime = 0.0f;
+
+	// Spatial audio settings
+	unsigned int maxSoundPropagationDepth = 0;
+	unsigned int diffractionFlags = 0;
+	float diffractionShadowAttenuationFactor = 0.0f;
+	float diffractionShadowDegrees = 0.0f;
+	// Vertices closer than this are merged when registering geometry, 0 only merges identical vertices
+	float geometryWeldTolerance = 0.0f;
+	// Geometry sets welded by set_geometry_async that are uploaded per frame, 0 uploads all that are ready
+	unsigned int geometryCommitsPerFrame = 0;
+	// Occlusion rays cast per physics frame across all emitters, one per collider hit, 0 updates every emitter
+	unsigned int occlusionRaysPerFrame = 0;
+	// Seconds for the occlusion of an emitter to mostly reach a new ray result, 0 applies results as is
+	float occlusionSmoothingTime = 0.0f;
+	// Occlusion added by each collider between an emitter and its listener
+	float occlusionPerHit = 0.0f;
+	unsigned int occlusionCollisionMask = 0;
+	float movementThreshold = 0.0f;
+	unsigned int numberOfPrimaryRays = 0;
+	unsigned int maxReflectionOrder = 0;
+	float maxPathLength = 0.0f;
+	bool enableDiffractionOnReflections = false;
+	bool enableDirectPathDiffraction = false;
+	bool enableTransmission = false;
+
+	// Emitter LOD settings, only used for emitters given a max attenuation radius
+	float emitterLodFullRateRatio = 0.0f;
+	unsigned int emitterLodReducedInterval = 0;
+	float emitterLodResumeMargin = 0.0f;
+	float emitterLodHysteresis = 0.0f;
+
+	// Emitter clustering settings
+	float emitterClusterRadius = 0.0f;
+	unsigned int maxEmitterClusters = 0;
+
+	// Transient game object settings, the pool grows past its initial size up to the max when every game object of
+	// it is playing
+	unsigned int transientGameObjectPoolSize = 0;
+	unsigned int maxTransientGameObjects = 0;
+
+	// Communication settings
+	bool initializeSystemComms = false;
+	unsigned int commandPort = 0;
+	unsigned int discoveryBroadcastPort = 0;
+	unsigned int notificationPort = 0;
+	String networkName;
+
+	// Platform-specific settings
+#ifdef AK_WIN
+	bool globalFocus = false;
+	unsigned int audioAPI = 0;
+#elif defined(AK_IOS)
+	unsigned int audioSessionCategory = 0;
+	unsigned int audioSessionCategoryOptions = 0;
+	unsigned int audioSessionMode = 0;
+#elif defined(AK_ANDROID)
+	unsigned int audioAPI = 0;
+	bool roundFrameSizeToHWSize = false;
+#elif defined(AK_LINUX)
+	unsigned int audioAPI = 0;
+#endif
+};
+} // namespace godot
+
+#endif
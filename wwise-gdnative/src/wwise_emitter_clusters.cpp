@@ -0,0 +1,236 @@
+#include "wwise_emitter_clusters.h"
+
+#include <algorithm>
+#include <limits>
+
+using namespace godot;
+
+namespace
+{
+float distanceSquared(const Vector3& a, const Vector3& b)
+{
+	const Vector3 offset = a - b;
+	return offset.x * offset.x + offset.y * offset.y + offset.z * offset.z;
+}
+} // namespace
+
+void WwiseEmitterClusters::setSettings(const float clusterRadius, const unsigned int maxClusters)
+{
+	this->clusterRadius = std::max(clusterRadius, 0.0f);
+	this->maxClusters = std::max(maxClusters, 1u);
+}
+
+void WwiseEmitterClusters::setEmitter(const uint64_t emitterID, const uint32_t eventID, const Transform& transform)
+{
+	Emitter& emitter = emitters[emitterID];
+
+	// Emitters switching event leave their cluster, they are put in one of the new event by update
+	if (emitter.clusterID != NO_CLUSTER && emitter.eventID != eventID)
+	{
+		detach(emitterID, emitter);
+	}
+
+	emitter.eventID = eventID;
+	emitter.transform = transform;
+
+	if (!emitter.moved)
+	{
+		emitter.moved = true;
+		movedEmitters.push_back(emitterID);
+	}
+}
+
+bool WwiseEmitterClusters::removeEmitter(const uint64_t emitterID)
+{
+	auto emitter = emitters.find(emitterID);
+
+	if (emitter == emitters.end())
+	{
+		return false;
+	}
+
+	if (emitter->second.clusterID != NO_CLUSTER)
+	{
+		detach(emitterID, emitter->second);
+	}
+
+	// Stale entries in movedEmitters are skipped by update
+	emitters.erase(emitter);
+	return true;
+}
+
+uint64_t WwiseEmitterClusters::getCluster(const uint64_t emitterID) const
+{
+	auto emitter = emitters.find(emitterID);
+	return emitter != emitters.end() ? emitter->second.clusterID : NO_CLUSTER;
+}
+
+void WwiseEmitterClusters::update(std::vector<ClusterChange>& out_changes)
+{
+	const float radiusSquared = clusterRadius * clusterRadius;
+
+	for (const uint64_t emitterID : movedEmitters)
+	{
+		auto entry = emitters.find(emitterID);
+
+		if (entry == emitters.end() || !entry->second.moved)
+		{
+			continue;
+		}
+
+		Emitter& emitter = entry->second;
+		emitter.moved = false;
+
+		if (emitter.clusterID != NO_CLUSTER)
+		{
+			Cluster& cluster = clusters[emitter.clusterID];
+
+			// Emitters still within the radius of their cluster stay, only their position is updated
+			if (distanceSquared(cluster.center, emitter.transform.origin) <= radiusSquared ||
+				cluster.emitters.size() == 1)
+			{
+				cluster.changed = true;
+				continue;
+			}
+
+			detach(emitterID, emitter);
+		}
+
+		attach(emitterID, emitter, findCluster(emitter.eventID, emitter.transform.origin));
+	}
+
+	movedEmitters.clear();
+	out_changes.insert(out_changes.end(), removedClusters.begin(), removedClusters.end());
+	removedClusters.clear();
+
+	for (auto& entry : clusters)
+	{
+		Cluster& cluster = entry.second;
+
+		if (!cluster.changed)
+		{
+			continue;
+		}
+
+		// Emitters that moved within the radius shift the center, the sum is rebuilt from the current transforms
+		cluster.positionSum = Vector3();
+
+		for (const uint64_t emitterID : cluster.emitters)
+		{
+			cluster.positionSum = cluster.positionSum + emitters[emitterID].transform.origin;
+		}
+
+		const float count = static_cast<float>(cluster.emitters.size());
+		cluster.center = Vector3(cluster.positionSum.x / count, cluster.positionSum.y / count,
+								 cluster.positionSum.z / count);
+		cluster.changed = false;
+
+		if (!cluster.created)
+		{
+			cluster.created = true;
+			out_changes.push_back({entry.first, cluster.eventID, CLUSTER_CREATED});
+		}
+
+		out_changes.push_back({entry.first, cluster.eventID, CLUSTER_MOVED});
+	}
+}
+
+void WwiseEmitterClusters::getTransforms(const uint64_t clusterID, std::vector<Transform>& out_transforms) const
+{
+	auto cluster = clusters.find(clusterID);
+
+	if (cluster == clusters.end())
+	{
+		return;
+	}
+
+	for (const uint64_t emitterID : cluster->second.emitters)
+	{
+		out_transforms.push_back(emitters.at(emitterID).transform);
+	}
+}
+
+void WwiseEmitterClusters::clear()
+{
+	emitters.clear();
+	movedEmitters.clear();
+	clusters.clear();
+	eventClusters.clear();
+	removedClusters.clear();
+}
+
+uint64_t WwiseEmitterClusters::findCluster(const uint32_t eventID, const Vector3& position)
+{
+	std::vector<uint64_t>& candidates = eventClusters[eventID];
+
+	uint64_t closestID = NO_CLUSTER;
+	float closestDistance = std::numeric_limits<float>::max();
+
+	for (const uint64_t clusterID : candidates)
+	{
+		const float distance = distanceSquared(clusters[clusterID].center, position);
+
+		if (distance < closestDistance)
+		{
+			closestID = clusterID;
+			closestDistance = distance;
+		}
+	}
+
+	// Past the maximum, emitters join the closest cluster of their event however far it is. An event without any
+	// cluster still gets one so it is heard.
+	const bool withinRadius = closestID != NO_CLUSTER && closestDistance <= clusterRadius * clusterRadius;
+
+	if (withinRadius || (closestID != NO_CLUSTER && clusters.size() >= maxClusters))
+	{
+		return closestID;
+	}
+
+	const uint64_t clusterID = nextClusterID++;
+	Cluster& cluster = clusters[clusterID];
+	cluster.eventID = eventID;
+	cluster.center = position;
+	candidates.push_back(clusterID);
+
+	return clusterID;
+}
+
+void WwiseEmitterClusters::attach(const uint64_t emitterID, Emitter& emitter, const uint64_t clusterID)
+{
+	Cluster& cluster = clusters[clusterID];
+	cluster.emitters.push_back(emitterID);
+	cluster.changed = true;
+	emitter.clusterID = clusterID;
+}
+
+void WwiseEmitterClusters::detach(const uint64_t emitterID, Emitter& emitter)
+{
+	const uint64_t clusterID = emitter.clusterID;
+	emitter.clusterID = NO_CLUSTER;
+
+	auto cluster = clusters.find(clusterID);
+
+	if (cluster == clusters.end())
+	{
+		return;
+	}
+
+	std::vector<uint64_t>& members = cluster->second.emitters;
+	members.erase(std::remove(members.begin(), members.end(), emitterID), members.end());
+
+	if (!members.empty())
+	{
+		cluster->second.changed = true;
+		return;
+	}
+
+	// Clusters that were never created in the sound engine do not need to be removed from it
+	if (cluster->second.created)
+	{
+		removedClusters.push_back({clusterID, cluster->second.eventID, CLUSTER_REMOVED});
+	}
+
+	std::vector<uint64_t>& candidates = eventClusters[cluster->second.eventID];
+	candidates.erase(std::remove(candidates.begin(), candidates.end(), clusterID), candidates.end());
+	clusters.erase(cluster);
+}
@@ -0,0 +1,90 @@
+#ifndef WWISE_EMITTER_CLUSTERS_H
+#define WWISE_EMITTER_CLUSTERS_H
+
+#include <Transform.hpp>
+#include <Vector3.hpp>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace godot
+{
+// Groups nearby emitters playing the same event into clusters, each one played by a single game object with one
+// position per emitter. Emitters only change cluster when they move out of the radius of their cluster, clusters are
+// created while there are fewer than the maximum and emitters join the closest cluster of their event otherwise.
+class WwiseEmitterClusters
+{
+  public:
+	// Cluster game object IDs are above this, out of the range of Godot instance IDs
+	static const uint64_t CLUSTER_ID_BASE = 0x7F00000000000000ull;
+	static const uint64_t NO_CLUSTER = 0;
+
+	enum ChangeType
+	{
+		CLUSTER_CREATED,
+		CLUSTER_MOVED,
+		CLUSTER_REMOVED
+	};
+
+	struct ClusterChange
+	{
+		uint64_t clusterID;
+		uint32_t eventID;
+		ChangeType type;
+	};
+
+	void setSettings(const float clusterRadius, const unsigned int maxClusters);
+
+	void setEmitter(const uint64_t emitterID, const uint32_t eventID, const Transform& transform);
+	bool removeEmitter(const uint64_t emitterID);
+	uint64_t getCluster(const uint64_t emitterID) const;
+	size_t getClusterCount() const
+	{
+		return clusters.size();
+	}
+
+	// Reassigns the emitters that moved since the last call and appends the clusters that need to be created, moved
+	// or removed. Created clusters are also reported as moved so their positions are set.
+	void update(std::vector<ClusterChange>& out_changes);
+	// Transforms of the emitters of the cluster, in no particular order
+	void getTransforms(const uint64_t clusterID, std::vector<Transform>& out_transforms) const;
+	void clear();
+
+  private:
+	struct Emitter
+	{
+		uint32_t eventID = 0;
+		Transform transform;
+		uint64_t clusterID = NO_CLUSTER;
+		bool moved = false;
+	};
+
+	struct Cluster
+	{
+		uint32_t eventID = 0;
+		std::vector<uint64_t> emitters;
+		Vector3 positionSum;
+		Vector3 center;
+		bool created = false;
+		bool changed = false;
+	};
+
+	uint64_t findCluster(const uint32_t eventID, const Vector3& position);
+	void attach(const uint64_t emitterID, Emitter& emitter, const uint64_t clusterID);
+	void detach(const uint64_t emitterID, Emitter& emitter);
+
+	float clusterRadius = 0.0f;
+	unsigned int maxClusters = 0;
+
+	std::unordered_map<uint64_t, Emitter> emitters;
+	std::vector<uint64_t> movedEmitters;
+	std::unordered_map<uint64_t, Cluster> clusters;
+	// Clusters per event, kept so an emitter only looks at the clusters it can join
+	std::unordered_map<uint32_t, std::vector<uint64_t>> eventClusters;
+	std::vector<ClusterChange> removedClusters;
+	uint64_t nextClusterID = CLUSTER_ID_BASE;
+};
+} // namespace godot
+
+#endif
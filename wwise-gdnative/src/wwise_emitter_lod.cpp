@@ -0,0 +1,176 @@
+#include "wwise_emitter_lod.h"
+
+#include <algorithm>
+
+using namespace godot;
+
+void WwiseEmitterLod::setSettings(const Settings& settings)
+{
+	this->settings = settings;
+	this->settings.reducedInterval = std::max(settings.reducedInterval, 1u);
+}
+
+void WwiseEmitterLod::setListener(const uint64_t listenerID)
+{
+	this->listenerID = listenerID;
+	listenerPositioned = false;
+}
+
+void WwiseEmitterLod::setEmitter(const uint64_t emitterID, const float maxRadius)
+{
+	if (maxRadius <= 0.0f)
+	{
+		emitters.erase(emitterID);
+		return;
+	}
+
+	auto emitter = emitters.find(emitterID);
+
+	if (emitter == emitters.end())
+	{
+		emitter = emitters.emplace(emitterID, Emitter()).first;
+		emitter->second.slot = nextSlot++;
+	}
+
+	emitter->second.maxRadius = maxRadius;
+}
+
+void WwiseEmitterLod::removeGameObject(const uint64_t gameObjectID)
+{
+	emitters.erase(gameObjectID);
+
+	if (gameObjectID == listenerID)
+	{
+		listenerID = 0;
+		listenerPositioned = false;
+	}
+}
+
+bool WwiseEmitterLod::setTransform(const uint64_t gameObjectID, const Transform& transform)
+{
+	if (gameObjectID == listenerID)
+	{
+		listenerPosition = transform.origin;
+		listenerPositioned = true;
+		return true;
+	}
+
+	auto emitter = emitters.find(gameObjectID);
+
+	if (emitter == emitters.end())
+	{
+		return true;
+	}
+
+	emitter->second.transform = transform;
+	emitter->second.positioned = true;
+
+	if (emitter->second.tier == TIER_FULL)
+	{
+		emitter->second.pending = false;
+		++stats.positionsSent;
+		return true;
+	}
+
+	// Sent by update once the emitter is due, only the latest transform is kept
+	emitter->second.pending = true;
+	++stats.positionsSkipped;
+	return false;
+}
+
+const Transform* WwiseEmitterLod::getTransform(const uint64_t gameObjectID) const
+{
+	auto emitter = emitters.find(gameObjectID);
+	return emitter != emitters.end() && emitter->second.positioned ? &emitter->second.transform : nullptr;
+}
+
+WwiseEmitterLod::Tier WwiseEmitterLod::getTier(const uint64_t gameObjectID) const
+{
+	auto emitter = emitters.find(gameObjectID);
+	return emitter != emitters.end() ? emitter->second.tier : TIER_FULL;
+}
+
+void WwiseEmitterLod::update(std::vector<uint64_t>& out_dueEmitters,
+							 std::vector<ActivityChange>& out_activityChanges)
+{
+	++frame;
+
+	for (auto& entry : emitters)
+	{
+		Emitter& emitter = entry.second;
+		const Tier tier = findTier(emitter);
+
+		if (tier != emitter.tier)
+		{
+			if (tier == TIER_SUSPENDED || emitter.tier == TIER_SUSPENDED)
+			{
+				out_activityChanges.push_back({entry.first, tier != TIER_SUSPENDED});
+			}
+
+			// Emitters getting closer are brought up to date right away instead of waiting for their turn
+			if (tier < emitter.tier && emitter.pending)
+			{
+				emitter.pending = false;
+				out_dueEmitters.push_back(entry.first);
+				++stats.positionsSent;
+			}
+
+			emitter.tier = tier;
+		}
+
+		++stats.tierCounts[emitter.tier];
+
+		if (emitter.tier == TIER_REDUCED && emitter.pending && (frame + emitter.slot) % settings.reducedInterval == 0)
+		{
+			emitter.pending = false;
+			out_dueEmitters.push_back(entry.first);
+			++stats.positionsSent;
+		}
+	}
+
+	lastStats = stats;
+	stats = Stats();
+}
+
+void WwiseEmitterLod::clear()
+{
+	emitters.clear();
+	listenerID = 0;
+	listenerPositioned = false;
+	stats = Stats();
+	lastStats = Stats();
+}
+
+WwiseEmitterLod::Tier WwiseEmitterLod::findTier(const Emitter& emitter) const
+{
+	// Without both positions there is nothing to cull against
+	if (!listenerPositioned || !emitter.positioned)
+	{
+		return TIER_FULL;
+	}
+
+	const Vector3 offset = emitter.transform.origin - listenerPosition;
+	const float distanceSquared = offset.x * offset.x + offset.y * offset.y + offset.z * offset.z;
+
+	// Moving away only takes effect past the boundary pushed out by the hysteresis, getting closer is immediate
+	const float stretch = 1.0f + settings.hysteresis;
+	float fullDistance = emitter.maxRadius * settings.fullRateRatio;
+	float audibleDistance = emitter.maxRadius + settings.resumeMargin;
+
+	if (emitter.tier == TIER_FULL)
+	{
+		fullDistance *= stretch;
+	}
+
+	if (emitter.tier != TIER_SUSPENDED)
+	{
+		audibleDistance *= stretch;
+	}
+
+	if (distanceSquared <= fullDistance * fullDistance)
+	{
+		return TIER_FULL;
+	}
+
+	return distanceSquared <= audibleDistance * audibleDistance ? TIER_REDUCED : TIER_SUSPENDED;
+}
@@ -0,0 +1,102 @@
+#ifndef WWISE_EMITTER_LOD_H
+#define WWISE_EMITTER_LOD_H
+
+#include <Transform.hpp>
+#include <Vector3.hpp>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace godot
+{
+// Decides how often the position of an emitter reaches the sound engine from its distance to the listener and its
+// max attenuation radius. Close emitters are sent every frame, the ones further away every few frames, and the ones
+// out of audible range not at all until they come back within the resume margin. Emitters without a radius are always
+// sent, as before.
+class WwiseEmitterLod
+{
+  public:
+	enum Tier
+	{
+		TIER_FULL,
+		TIER_REDUCED,
+		TIER_SUSPENDED,
+		TIER_COUNT
+	};
+
+	struct Settings
+	{
+		// Emitters closer than this fraction of their radius are updated every frame
+		float fullRateRatio = 0.5f;
+		// Frames between two updates of a reduced emitter, spread over the emitters so they do not all land together
+		unsigned int reducedInterval = 4;
+		// Distance past the radius where emitters are resumed, so they are positioned before they become audible
+		float resumeMargin = 0.0f;
+		// Fraction a tier boundary is pushed out by when moving away, so emitters on it do not flicker between tiers
+		float hysteresis = 0.0f;
+	};
+
+	struct ActivityChange
+	{
+		uint64_t emitterID;
+		bool active;
+	};
+
+	struct Stats
+	{
+		unsigned int tierCounts[TIER_COUNT] = {};
+		unsigned int positionsSent = 0;
+		unsigned int positionsSkipped = 0;
+	};
+
+	void setSettings(const Settings& settings);
+	void setListener(const uint64_t listenerID);
+	// A radius of 0 or less stops culling the emitter
+	void setEmitter(const uint64_t emitterID, const float maxRadius);
+	void removeGameObject(const uint64_t gameObjectID);
+
+	// Records the transform, returns whether it should be sent to the sound engine right away
+	bool setTransform(const uint64_t gameObjectID, const Transform& transform);
+	const Transform* getTransform(const uint64_t gameObjectID) const;
+	Tier getTier(const uint64_t gameObjectID) const;
+	// Counts of the last update
+	const Stats& getStats() const
+	{
+		return lastStats;
+	}
+
+	// Moves the emitters between tiers, appends the ones whose recorded transform is now due and the ones that were
+	// suspended or resumed
+	void update(std::vector<uint64_t>& out_dueEmitters, std::vector<ActivityChange>& out_activityChanges);
+	void clear();
+
+  private:
+	struct Emitter
+	{
+		float maxRadius = 0.0f;
+		Tier tier = TIER_FULL;
+		unsigned int slot = 0;
+		Transform transform;
+		bool positioned = false;
+		bool pending = false;
+	};
+
+	Tier findTier(const Emitter& emitter) const;
+
+	Settings settings;
+
+	uint64_t listenerID = 0;
+	Vector3 listenerPosition;
+	bool listenerPositioned = false;
+
+	std::unordered_map<uint64_t, Emitter> emitters;
+	unsigned int nextSlot = 0;
+	uint64_t frame = 0;
+
+	Stats stats;
+	Stats lastStats;
+};
+} // namespace godot
+
+#endif
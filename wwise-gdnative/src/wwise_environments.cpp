@@ -0,0 +1,190 @@
+#include "wwise_environments.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace godot;
+
+constexpr float WwiseEnvironmentManager::CONTROL_VALUE_EPSILON;
+
+void WwiseEnvironmentManager::addZone(const uint64_t zoneID, const uint32_t auxBusID, const Transform& transform,
+									  const Vector3& extents, const int priority, const float fadeDistance)
+{
+	// The fade distance grows the bounds so game objects in the fade margin are found by the grid
+	zones.add(WwiseVolume(zoneID, transform, extents, priority, fadeDistance));
+	zoneAuxBuses[zoneID] = auxBusID;
+}
+
+void WwiseEnvironmentManager::removeZone(const uint64_t zoneID)
+{
+	zones.removeOwner(zoneID);
+	zoneAuxBuses.erase(zoneID);
+}
+
+void WwiseEnvironmentManager::setEnvironmentAware(const uint64_t gameObjectID, const bool enabled)
+{
+	if (!enabled)
+	{
+		removeGameObject(gameObjectID);
+		return;
+	}
+
+	trackedObjects.emplace(gameObjectID, TrackedObject());
+}
+
+void WwiseEnvironmentManager::setPosition(const uint64_t gameObjectID, const Vector3& position)
+{
+	auto trackedObject = trackedObjects.find(gameObjectID);
+
+	if (trackedObject == trackedObjects.end())
+	{
+		return;
+	}
+
+	trackedObject->second.position = position;
+	trackedObject->second.positioned = true;
+
+	if (!trackedObject->second.moved)
+	{
+		trackedObject->second.moved = true;
+		movedObjects.push_back(gameObjectID);
+	}
+}
+
+void WwiseEnvironmentManager::removeGameObject(const uint64_t gameObjectID)
+{
+	// Stale entries in movedObjects are skipped by update
+	trackedObjects.erase(gameObjectID);
+}
+
+int WwiseEnvironmentManager::getSends(const uint64_t gameObjectID, Send (&out_sends)[MAX_SENDS]) const
+{
+	auto trackedObject = trackedObjects.find(gameObjectID);
+
+	if (trackedObject == trackedObjects.end())
+	{
+		return 0;
+	}
+
+	std::copy(trackedObject->second.sends, trackedObject->second.sends + MAX_SENDS, out_sends);
+	return trackedObject->second.sendCount;
+}
+
+void WwiseEnvironmentManager::update(std::vector<SendChange>& out_changes)
+{
+	if (zones.update())
+	{
+		for (auto& trackedObject : trackedObjects)
+		{
+			updateObject(trackedObject.first, trackedObject.second, out_changes);
+		}
+	}
+	else
+	{
+		for (const uint64_t gameObjectID : movedObjects)
+		{
+			auto trackedObject = trackedObjects.find(gameObjectID);
+
+			if (trackedObject != trackedObjects.end() && trackedObject->second.moved)
+			{
+				updateObject(gameObjectID, trackedObject->second, out_changes);
+			}
+		}
+	}
+
+	movedObjects.clear();
+}
+
+void WwiseEnvironmentManager::clear()
+{
+	zones.clear();
+	zoneAuxBuses.clear();
+	trackedObjects.clear();
+	movedObjects.clear();
+}
+
+void WwiseEnvironmentManager::updateObject(const uint64_t gameObjectID, TrackedObject& trackedObject,
+										   std::vector<SendChange>& out_changes)
+{
+	trackedObject.moved = false;
+
+	if (!trackedObject.positioned)
+	{
+		return;
+	}
+
+	volumeCandidates.clear();
+	sendCandidates.clear();
+	zones.query(trackedObject.position, volumeCandidates);
+
+	for (const WwiseVolume* zone : volumeCandidates)
+	{
+		const float distance = zone->distance(trackedObject.position);
+
+		if (distance > zone->margin)
+		{
+			continue;
+		}
+
+		const float controlValue = zone->margin > 0.0f ? 1.0f - distance / zone->margin : 1.0f;
+
+		if (controlValue <= 0.0f)
+		{
+			continue;
+		}
+
+		const uint32_t auxBusID = zoneAuxBuses[zone->ownerID];
+
+		// Several zones on the same aux bus, or several boxes of one zone, make a single send
+		auto existing = std::find_if(sendCandidates.begin(), sendCandidates.end(), [auxBusID](const Candidate& c) {
+			return c.send.auxBusID == auxBusID;
+		});
+
+		if (existing == sendCandidates.end())
+		{
+			sendCandidates.push_back({zone->priority, {auxBusID, controlValue}});
+		}
+		else
+		{
+			existing->priority = std::min(existing->priority, zone->priority);
+			existing->send.controlValue = std::max(existing->send.controlValue, controlValue);
+		}
+	}
+
+	std::sort(sendCandidates.begin(), sendCandidates.end(), [](const Candidate& a, const Candidate& b) {
+		if (a.priority != b.priority)
+		{
+			return a.priority < b.priority;
+		}
+
+		return a.send.controlValue > b.send.controlValue;
+	});
+
+	const int sendCount = std::min(static_cast<int>(sendCandidates.size()), MAX_SENDS);
+	bool changed = sendCount != trackedObject.sendCount;
+
+	for (int i = 0; i < sendCount && !changed; ++i)
+	{
+		changed = sendCandidates[i].send.auxBusID != trackedObject.sends[i].auxBusID ||
+				  std::abs(sendCandidates[i].send.controlValue - trackedObject.sends[i].controlValue) >
+					  CONTROL_VALUE_EPSILON;
+	}
+
+	if (!changed)
+	{
+		return;
+	}
+
+	SendChange change;
+	change.gameObjectID = gameObjectID;
+	change.sendCount = sendCount;
+
+	for (int i = 0; i < sendCount; ++i)
+	{
+		change.sends[i] = sendCandidates[i].send;
+		trackedObject.sends[i] = sendCandidates[i].send;
+	}
+
+	trackedObject.sendCount = sendCount;
+	out_changes.push_back(change);
+}
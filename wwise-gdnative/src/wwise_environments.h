@@ -0,0 +1,84 @@
+#ifndef WWISE_ENVIRONMENTS_H
+#define WWISE_ENVIRONMENTS_H
+
+#include <Transform.hpp>
+#include <Vector3.hpp>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "wwise_volumes.h"
+
+namespace godot
+{
+// Computes the aux sends of environment aware game objects from the environment zones they are in or near, replacing
+// the Area signals of AkEnvironment and the per-frame script of AkEvent. Only the game objects that moved since the
+// last update are looked up again, unless the zones changed, and only sends that differ are returned.
+class WwiseEnvironmentManager
+{
+  public:
+	// Matches AK_MAX_ENVIRONMENTS
+	static const int MAX_SENDS = 4;
+
+	struct Send
+	{
+		uint32_t auxBusID;
+		float controlValue;
+	};
+
+	struct SendChange
+	{
+		uint64_t gameObjectID;
+		int sendCount;
+		Send sends[MAX_SENDS];
+	};
+
+	// Zones with the lowest priority are sent first, as with AkEnvironment. The control value is 1 inside the box and
+	// fades out linearly over fadeDistance outside of it.
+	void addZone(const uint64_t zoneID, const uint32_t auxBusID, const Transform& transform, const Vector3& extents,
+				 const int priority, const float fadeDistance);
+	void removeZone(const uint64_t zoneID);
+
+	void setEnvironmentAware(const uint64_t gameObjectID, const bool enabled);
+	// Ignored for game objects that are not environment aware
+	void setPosition(const uint64_t gameObjectID, const Vector3& position);
+	void removeGameObject(const uint64_t gameObjectID);
+	int getSends(const uint64_t gameObjectID, Send (&out_sends)[MAX_SENDS]) const;
+
+	// Appends the game objects whose sends changed since the last call
+	void update(std::vector<SendChange>& out_changes);
+	void clear();
+
+  private:
+	struct TrackedObject
+	{
+		Vector3 position;
+		int sendCount = 0;
+		Send sends[MAX_SENDS];
+		bool moved = false;
+		bool positioned = false;
+	};
+
+	struct Candidate
+	{
+		int priority;
+		Send send;
+	};
+
+	void updateObject(const uint64_t gameObjectID, TrackedObject& trackedObject, std::vector<SendChange>& out_changes);
+
+	// Control values closer than this are not sent again
+	static constexpr float CONTROL_VALUE_EPSILON = 0.001f;
+
+	WwiseVolumeGrid zones;
+	std::unordered_map<uint64_t, uint32_t> zoneAuxBuses;
+	std::vector<const WwiseVolume*> volumeCandidates;
+	std::vector<Candidate> sendCandidates;
+
+	std::unordered_map<uint64_t, TrackedObject> trackedObjects;
+	std::vector<uint64_t> movedObjects;
+};
+} // namespace godot
+
+#endif
@@ -43,6 +43,11 @@ void WwiseAssertHook(const char* in_pszExpression, const char* in_pszFileName, i
 }
 #endif
 
+// Profiles an API method that pushes commands to the sound engine, and marks the start of the command latency window
+#define WWISE_COMMAND_SCOPE(name)                                                                                      \
+	WWISE_PROFILE_SCOPE(name);                                                                                         \
+	noteCommandSubmission()
+
 void LocalOutput(AK::Monitor::ErrorCode in_eErrorCode, const AkOSChar* in_pszError,
 				 AK::Monitor::ErrorLevel in_eErrorLevel, AkPlayingID in_playingID, AkGameObjectID in_gameObjID)
 {
@@ -69,7 +74,9 @@ Wwise::~Wwise()
 
 void Wwise::_register_methods()
 {
+	register_method("_ready", &Wwise::_ready);
 	register_method("_process", &Wwise::_process);
+	register_method("_physics_process", &Wwise::_physics_process);
 	register_method("_notification", &Wwise::_notification);
 	register_method("set_current_language", &Wwise::setCurrentLanguage);
 	register_method("load_bank", &Wwise::loadBank);
@@ -90,6 +97,8 @@ void Wwise::_register_methods()
 	register_method("post_event_callback", &Wwise::postEventCallback);
 	register_method("post_event_id", &Wwise::postEventID);
 	register_method("post_event_id_callback", &Wwise::postEventIDCallback);
+	register_method("post_event_at_position", &Wwise::postEventAtPosition);
+	register_method("get_transient_game_obj_stats", &Wwise::getTransientGameObjectStats);
 	register_method("stop_event", &Wwise::stopEvent);
 	register_method("set_switch", &Wwise::setSwitch);
 	register_method("set_switch_id", &Wwise::setSwitchID);
@@ -107,12 +116,36 @@ void Wwise::_register_methods()
 	register_method("get_playing_segment_info", &Wwise::getPlayingSegmentInfo);
 	register_method("set_game_obj_output_bus_volume", &Wwise::setGameObjectOutputBusVolume);
 	register_method("set_game_obj_aux_send_values", &Wwise::setGameObjectAuxSendValues);
+	register_method("add_environment_zone", &Wwise::addEnvironmentZone);
+	register_method("remove_environment_zone", &Wwise::removeEnvironmentZone);
+	register_method("set_game_obj_environment_aware", &Wwise::setGameObjectEnvironmentAware);
+	register_method("get_game_obj_aux_sends", &Wwise::getGameObjectAuxSends);
+	register_method("set_game_obj_occlusion", &Wwise::setGameObjectOcclusion);
+	register_method("remove_game_obj_occlusion", &Wwise::removeGameObjectOcclusion);
+	register_method("get_game_obj_occlusion", &Wwise::getGameObjectOcclusion);
+	register_method("set_game_obj_max_radius", &Wwise::setGameObjectMaxRadius);
+	register_method("get_game_obj_lod_tier", &Wwise::getGameObjectLodTier);
+	register_method("get_emitter_lod_stats", &Wwise::getEmitterLodStats);
+	register_method("set_clustered_emitter", &Wwise::setClusteredEmitter);
+	register_method("remove_clustered_emitter", &Wwise::removeClusteredEmitter);
+	register_method("get_emitter_cluster", &Wwise::getEmitterCluster);
+	register_method("get_emitter_cluster_count", &Wwise::getEmitterClusterCount);
 	register_method("set_obj_obstruction_and_occlusion", &Wwise::setObjectObstructionAndOcclusion);
 	register_method("set_geometry", &Wwise::setGeometry);
+	register_method("set_geometry_async", &Wwise::setGeometryAsync);
+	register_method("set_geometry_with_surfaces", &Wwise::setGeometryWithSurfaces);
+	register_method("set_geometry_from_mesh", &Wwise::setGeometryFromMesh);
+	register_method("set_geometry_from_mesh_async", &Wwise::setGeometryFromMeshAsync);
+	register_method("set_geometry_from_baked", &Wwise::setGeometryFromBaked);
+	register_method("set_geometry_transform", &Wwise::setGeometryTransform);
+	register_method("set_geometry_simplification", &Wwise::setGeometrySimplification);
+	register_method("get_geometry_stats", &Wwise::getGeometryStats);
 	register_method("remove_geometry", &Wwise::removeGeometry);
 	register_method("register_spatial_listener", &Wwise::registerSpatialListener);
 	register_method("set_room", &Wwise::setRoom);
 	register_method("remove_room", &Wwise::removeRoom);
+	register_method("add_room_volume", &Wwise::addRoomVolume);
+	register_method("get_game_obj_room", &Wwise::getGameObjectRoom);
 	register_method("set_portal", &Wwise::setPortal);
 	register_method("remove_portal", &Wwise::removePortal);
 	register_method("set_game_obj_in_room", &Wwise::setGameObjectInRoom);
@@ -124,6 +157,33 @@ void Wwise::_register_methods()
 	register_method("suspend", &Wwise::suspend);
 	register_method("wakeup_from_suspend", &Wwise::wakeupFromSuspend);
 
+	register_method("get_startup_timings", &Wwise::getStartupTimings);
+	register_method("get_memory_stats", &Wwise::getMemoryStats);
+	register_method("get_stats", &Wwise::getStats);
+	register_method("reset_stats", &Wwise::resetStats);
+	register_method("set_api_profiling_enabled", &Wwise::setApiProfilingEnabled);
+	register_method("get_api_report", &Wwise::getApiReport);
+	register_method("start_trace", &Wwise::startTrace);
+	register_method("stop_trace", &Wwise::stopTrace);
+	register_method("flush_trace", &Wwise::flushTrace);
+	register_method("begin_command_batch", &Wwise::beginCommandBatch);
+	register_method("end_command_batch", &Wwise::endCommandBatch);
+	register_method("render_frames", &Wwise::renderFrames);
+	register_method("start_output_capture", &Wwise::startOutputCapture);
+	register_method("stop_output_capture", &Wwise::stopOutputCapture);
+	register_method("read_captured_frames", &Wwise::readCapturedFrames);
+	register_method("read_captured_pcm16", &Wwise::readCapturedPCM16);
+	register_method("get_output_capture_info", &Wwise::getOutputCaptureInfo);
+	register_method("is_server_mode", &Wwise::isServerMode);
+	register_method("get_server_game_syncs", &Wwise::getServerGameSyncs);
+	register_method("start_call_recording", &Wwise::startCallRecording);
+	register_method("stop_call_recording", &Wwise::stopCallRecording);
+	register_method("save_call_recording", &Wwise::saveCallRecording);
+	register_method("replay_call_log", &Wwise::replayCallLog);
+#if defined(WWISE_BENCHMARKS)
+	register_method("run_benchmarks", &Wwise::runBenchmarks);
+#endif
+
 	REGISTER_GODOT_SIGNAL(AK_EndOfEvent);
 	REGISTER_GODOT_SIGNAL(AK_EndOfDynamicSequenceItem);
 	REGISTER_GODOT_SIGNAL(AK_Marker);
@@ -146,61 +206,93 @@ void Wwise::_register_methods()
 	REGISTER_GODOT_SIGNAL(AK_EnableGetMusicPlayPosition);
 	REGISTER_GODOT_SIGNAL(AK_EnableGetSourceStreamBuffering);
 	register_signal<Wwise>("bank_callback", "data", GODOT_VARIANT_TYPE_DICTIONARY);
+	register_signal<Wwise>("geometry_callback", "data", GODOT_VARIANT_TYPE_DICTIONARY);
 }
 
 void Wwise::_init()
 {
+	const int64_t startupStartUsec = OS::get_singleton()->get_ticks_usec();
+
 	signalDataArray = std::make_unique<Array>();
 	signalBankDataArray = std::make_unique<Array>();
 
 	projectSettings = ProjectSettings::get_singleton();
 	AKASSERT(projectSettings);
 
-	bool initialisationResult = initialiseWwiseSystems();
-
-	if (!initialisationResult)
-	{
-		ERROR_CHECK(AK_Fail, "Wwise systems initialisation failed!");
-		return;
-	}
-	else
-	{
-		Godot::print("Wwise systems initialisation succeeded");
-	}
+	AKPLATFORM::AkClearThread(&renderThread);
+	AKPLATFORM::AkClearThread(&geometryThread);
 
-	String basePath = getPlatformProjectSetting(WWISE_COMMON_USER_SETTINGS_PATH + "base_path");
+#ifndef AK_OPTIMIZED
+	AKPLATFORM::AkClearThread(&commInitThread);
+#endif
 
 #ifdef AK_WIN
-	String platformBanksSuffix = "/Windows";
+	platformSettingPostfix = GODOT_WINDOWS_SETTING_POSTFIX;
 #elif defined(AK_MAC_OS_X)
-	String platformBanksSuffix = "/Mac";
+	platformSettingPostfix = GODOT_MAC_OSX_SETTING_POSTFIX;
 #elif defined(AK_IOS)
-	String platformBanksSuffix = "/iOS";
+	platformSettingPostfix = GODOT_IOS_SETTING_POSTFIX;
 #elif defined(AK_ANDROID)
-	String platformBanksSuffix = "/Android";
+	platformSettingPostfix = GODOT_ANDROID_SETTING_POSTFIX;
 #elif defined(AK_LINUX)
-	String platformBanksSuffix = "/Linux";
+	platformSettingPostfix = GODOT_LINUX_SETTING_POSTFIX;
 #else
 #error "Platform not supported"
 #endif
 
-	basePath += platformBanksSuffix + "/";
+	loadConfig();
+	recordStartupTiming("settings", startupStartUsec, OS::get_singleton()->get_ticks_usec());
 
-	bool setBasePathResult = setBasePath(basePath);
-	AKASSERT(setBasePathResult);
+	serverMode = isServerModeRequested();
+
+	if (serverMode)
+	{
+		// Nothing is rendered, the API only keeps track of game syncs and answers bank requests
+		config.renderTickMode = RenderTickMode::RENDER_FRAME;
+		config.offlineRendering = false;
 
-	String startupLanguage = getPlatformProjectSetting(WWISE_COMMON_USER_SETTINGS_PATH + "startup_language");
+		Godot::print("Wwise server mode enabled, the sound engine is not initialised");
+		return;
+	}
 
-	setCurrentLanguage(startupLanguage);
+	signalCallbackDataMaxSize = config.callbackManagerBufferSize;
 
-	signalCallbackDataMaxSize = static_cast<unsigned int>(
-		getPlatformProjectSetting(WWISE_COMMON_USER_SETTINGS_PATH + "callback_manager_buffer_size"));
+	WwiseEmitterLod::Settings lodSettings;
+	lodSettings.fullRateRatio = config.emitterLodFullRateRatio;
+	lodSettings.reducedInterval = config.emitterLodReducedInterval;
+	lodSettings.resumeMargin = config.emitterLodResumeMargin;
+	lodSettings.hysteresis = config.emitterLodHysteresis;
+	emitterLod.setSettings(lodSettings);
+	emitterClusters.setSettings(config.emitterClusterRadius, config.maxEmitterClusters);
 
-#if !defined(AK_OPTIMIZED)
-	const bool engineLogging =
-		static_cast<bool>(getPlatformProjectSetting(WWISE_COMMON_USER_SETTINGS_PATH + "engine_logging"));
+	bool initialisationResult = initialiseWwiseSystems();
+
+	if (!initialisationResult)
+	{
+		waitForInitBankLoad();
+		ERROR_CHECK(AK_Fail, "Wwise systems initialisation failed!");
+		return;
+	}
+	else
+	{
+		Godot::print("Wwise systems initialisation succeeded");
+	}
+
+	maxTransientGameObjects = std::max(config.maxTransientGameObjects, config.transientGameObjectPoolSize);
+	freeTransientGameObjects.reserve(static_cast<size_t>(maxTransientGameObjects));
 
-	if (engineLogging)
+	for (unsigned int i = 0; i < config.transientGameObjectPoolSize; ++i)
+	{
+		AkGameObjectID gameObjectID = AK_INVALID_GAME_OBJECT;
+
+		if (registerTransientGameObject(gameObjectID))
+		{
+			freeTransientGameObjects.push_back(gameObjectID);
+		}
+	}
+
+#if !defined(AK_OPTIMIZED)
+	if (config.engineLogging)
 	{
 		ERROR_CHECK(AK::Monitor::SetLocalOutput(AK::Monitor::ErrorLevel_All,
 												static_cast<AK::Monitor::LocalOutputFunc>(LocalOutput)),
@@ -208,20 +300,134 @@ void Wwise::_init()
 	}
 #endif
 
-	bool loadInitBank = getPlatformProjectSetting(WWISE_COMMON_USER_SETTINGS_PATH + "load_init_bank_at_startup");
+	waitForInitBankLoad();
+
+	if (config.offlineRendering && config.renderTickMode == RenderTickMode::FIXED_RATE_THREAD)
+	{
+		Godot::print_warning("Offline rendering is driven by the main loop, ignoring the fixed rate render thread",
+							 __FUNCTION__, __FILE__, __LINE__);
+		config.renderTickMode = RenderTickMode::RENDER_FRAME;
+	}
+
+	if (config.renderTickMode == RenderTickMode::FIXED_RATE_THREAD && !startRenderThread())
+	{
+		Godot::print_warning("Failed to start the render thread, rendering on the main loop instead", __FUNCTION__,
+							 __FILE__, __LINE__);
+		config.renderTickMode = RenderTickMode::RENDER_FRAME;
+	}
+
+	recordStartupTiming("total", startupStartUsec, OS::get_singleton()->get_ticks_usec());
+
+	String timingsMessage = "Wwise startup timings (ms):";
+	const Array phases = startupTimings.keys();
 
-	if (loadInitBank)
+	for (int i = 0; i < phases.size(); ++i)
 	{
-		AkUInt32 initBankID = AK::SoundEngine::GetIDFromString("Init");
-		loadBankID(initBankID);
+		const String phase = phases[i];
+		const float durationMs = startupTimings[phase];
+		timingsMessage += " " + phase + "=" + String::num(durationMs, 2);
 	}
+
+	Godot::print(timingsMessage);
+}
+
+void Wwise::_ready()
+{
+	// Both callbacks are enabled automatically because they are registered, only keep the one driving RenderAudio.
+	// Occlusion rays also need the physics frame, set_game_obj_occlusion enables it when needed.
+	set_physics_process(!serverMode && (config.renderTickMode == RenderTickMode::PHYSICS_FRAME ||
+										!occlusionManager.empty()));
 }
 
 void Wwise::_process(const float delta)
 {
-	emitSignals();
-	emitBankSignals();
-	ERROR_CHECK(AK::SoundEngine::RenderAudio(), "");
+#if !defined(AK_OPTIMIZED)
+	WwiseApiProfiler::endFrame();
+#endif
+
+	WwiseCallLog::endFrame();
+
+	WWISE_TRACE_SCOPE("process");
+	WWISE_PROFILE_SCOPE("process");
+
+	processFrame();
+
+	if (!serverMode && config.renderTickMode == RenderTickMode::RENDER_FRAME)
+	{
+		renderAudio();
+	}
+
+	// Batches are meant to end within the frame that began them, a script that yielded or returned early in
+	// between would otherwise keep holding back the render thread
+	if (commandBatchOpen)
+	{
+		Godot::print_warning("end_command_batch was not called, the command batch is ended at the next frame",
+							 __FUNCTION__, __FILE__, __LINE__);
+		endCommandBatch();
+	}
+}
+
+void Wwise::processFrame()
+{
+	{
+		WWISE_TRACE_SCOPE("emit_signals");
+		WWISE_PROFILE_SCOPE("emit_signals");
+		emitSignals();
+	}
+
+	{
+		WWISE_TRACE_SCOPE("emit_bank_signals");
+		emitBankSignals();
+	}
+
+	{
+		WWISE_TRACE_SCOPE("commit_geometry");
+		WWISE_PROFILE_SCOPE("commit_geometry");
+		commitGeometryJobs();
+	}
+
+	{
+		WWISE_TRACE_SCOPE("resolve_rooms");
+		WWISE_PROFILE_SCOPE("resolve_rooms");
+		resolveRooms();
+	}
+
+	{
+		WWISE_TRACE_SCOPE("update_environments");
+		WWISE_PROFILE_SCOPE("update_environments");
+		updateEnvironments();
+	}
+
+	{
+		WWISE_TRACE_SCOPE("update_emitter_lod");
+		WWISE_PROFILE_SCOPE("update_emitter_lod");
+		updateEmitterLod();
+	}
+
+	{
+		WWISE_TRACE_SCOPE("update_emitter_clusters");
+		WWISE_PROFILE_SCOPE("update_emitter_clusters");
+		updateEmitterClusters();
+	}
+}
+
+void Wwise::_physics_process(const float delta)
+{
+	if (!occlusionManager.empty())
+	{
+		WWISE_TRACE_SCOPE("update_occlusion");
+		WWISE_PROFILE_SCOPE("update_occlusion");
+		updateOcclusion(delta);
+	}
+
+	if (config.renderTickMode == RenderTickMode::PHYSICS_FRAME)
+	{
+		renderAudio();
+	}
+	else if (occlusionManager.empty())
+	{
+		set_physics_process(false);
+	}
 }
 
 void Wwise::_notification(int notification)
@@ -266,6 +472,14 @@ bool Wwise::setBasePath(const String basePath)
 
 void Wwise::setCurrentLanguage(const String language)
 {
+	if (serverMode)
+	{
+		return;
+	}
+
+	WWISE_PROFILE_SCOPE("set_current_language");
+	WWISE_RECORD_CALL("set_current_language", language);
+
 	AKASSERT(!language.empty());
 
 	lowLevelIO.SetLanguageFolder(language);
@@ -273,6 +487,15 @@ void Wwise::setCurrentLanguage(const String language)
 
 bool Wwise::loadBank(const String bankName)
 {
+	if (serverMode)
+	{
+		return true;
+	}
+
+	WWISE_PROFILE_SCOPE("load_bank");
+	WWISE_TRACE_SCOPE("load_bank");
+	WWISE_RECORD_CALL("load_bank", bankName);
+
 	AkBankID bankID;
 	AKASSERT(!bankName.empty());
 
@@ -281,14 +504,38 @@ bool Wwise::loadBank(const String bankName)
 
 bool Wwise::loadBankID(const unsigned int bankID)
 {
+	if (serverMode)
+	{
+		return true;
+	}
+
+	WWISE_PROFILE_SCOPE("load_bank_id");
+	WWISE_TRACE_SCOPE("load_bank");
+	WWISE_RECORD_CALL("load_bank_id", bankID);
+
 	return ERROR_CHECK(AK::SoundEngine::LoadBank(bankID), "ID " + String::num_int64(bankID));
 }
 
 bool Wwise::loadBankAsync(const String bankName)
 {
+	if (serverMode)
+	{
+		bankCallback(AK::SoundEngine::GetIDFromString(bankName.alloc_c_string()), nullptr, AK_Success, 0);
+		return true;
+	}
+
+	WWISE_PROFILE_SCOPE("load_bank_async");
+	WWISE_RECORD_CALL("load_bank_async", bankName);
+
 	AkBankID bankID = 0;
 	AKASSERT(!bankName.empty());
 
+	if (WwiseTraceRecorder::isRecording())
+	{
+		WwiseTraceRecorder::recordAsyncBegin("bank", AK::SoundEngine::GetIDFromString(bankName.alloc_c_string()),
+											 "load");
+	}
+
 	return ERROR_CHECK(
 		AK::SoundEngine::LoadBank(bankName.alloc_c_string(), (AkBankCallbackFunc)bankCallback, nullptr, bankID),
 		"ID " + String::num_int64(bankID));
@@ -296,12 +543,34 @@ bool Wwise::loadBankAsync(const String bankName)
 
 bool Wwise::loadBankAsyncID(const unsigned int bankID)
 {
+	if (serverMode)
+	{
+		bankCallback(bankID, nullptr, AK_Success, 0);
+		return true;
+	}
+
+	WWISE_PROFILE_SCOPE("load_bank_async_id");
+	WWISE_RECORD_CALL("load_bank_async_id", bankID);
+
+	if (WwiseTraceRecorder::isRecording())
+	{
+		WwiseTraceRecorder::recordAsyncBegin("bank", bankID, "load");
+	}
+
 	return ERROR_CHECK(AK::SoundEngine::LoadBank(bankID, (AkBankCallbackFunc)bankCallback, nullptr),
 					   "ID " + String::num_int64(bankID));
 }
 
 bool Wwise::unloadBank(const String bankName)
 {
+	if (serverMode)
+	{
+		return true;
+	}
+
+	WWISE_PROFILE_SCOPE("unload_bank");
+	WWISE_RECORD_CALL("unload_bank", bankName);
+
 	AKASSERT(!bankName.empty());
 
 	return ERROR_CHECK(AK::SoundEngine::UnloadBank(bankName.alloc_c_string(), NULL), bankName);
@@ -309,13 +578,36 @@ bool Wwise::unloadBank(const String bankName)
 
 bool Wwise::unloadBankID(const unsigned int bankID)
 {
+	if (serverMode)
+	{
+		return true;
+	}
+
+	WWISE_PROFILE_SCOPE("unload_bank_id");
+	WWISE_RECORD_CALL("unload_bank_id", bankID);
+
 	return ERROR_CHECK(AK::SoundEngine::UnloadBank(bankID, NULL), "ID " + String::num_int64(bankID) + " failed");
 }
 
 bool Wwise::unloadBankAsync(const String bankName)
 {
+	if (serverMode)
+	{
+		bankCallback(AK::SoundEngine::GetIDFromString(bankName.alloc_c_string()), nullptr, AK_Success, 0);
+		return true;
+	}
+
+	WWISE_PROFILE_SCOPE("unload_bank_async");
+	WWISE_RECORD_CALL("unload_bank_async", bankName);
+
 	AKASSERT(!bankName.empty());
 
+	if (WwiseTraceRecorder::isRecording())
+	{
+		WwiseTraceRecorder::recordAsyncBegin("bank", AK::SoundEngine::GetIDFromString(bankName.alloc_c_string()),
+											 "unload");
+	}
+
 	return ERROR_CHECK(
 		AK::SoundEngine::UnloadBank(bankName.alloc_c_string(), NULL, (AkBankCallbackFunc)bankCallback, nullptr),
 		"Loading bank: " + bankName + " failed");
@@ -323,12 +615,34 @@ bool Wwise::unloadBankAsync(const String bankName)
 
 bool Wwise::unloadBankAsyncID(const unsigned int bankID)
 {
+	if (serverMode)
+	{
+		bankCallback(bankID, nullptr, AK_Success, 0);
+		return true;
+	}
+
+	WWISE_PROFILE_SCOPE("unload_bank_async_id");
+	WWISE_RECORD_CALL("unload_bank_async_id", bankID);
+
+	if (WwiseTraceRecorder::isRecording())
+	{
+		WwiseTraceRecorder::recordAsyncBegin("bank", bankID, "unload");
+	}
+
 	return ERROR_CHECK(AK::SoundEngine::UnloadBank(bankID, NULL, (AkBankCallbackFunc)bankCallback, nullptr),
 					   "ID " + String::num_int64(bankID) + " failed");
 }
 
 bool Wwise::registerListener(const Object* gameObject)
 {
+	if (serverMode)
+	{
+		return true;
+	}
+
+	WWISE_COMMAND_SCOPE("register_listener");
+	WWISE_RECORD_CALL("register_listener", gameObject);
+
 	AKASSERT(gameObject);
 
 	const AkGameObjectID listener = static_cast<AkGameObjectID>(gameObject->get_instance_id());
@@ -344,11 +658,22 @@ bool Wwise::registerListener(const Object* gameObject)
 		return false;
 	}
 
+	// Emitters are culled against the default listener
+	emitterLod.setListener(gameObject->get_instance_id());
+
 	return true;
 }
 
 bool Wwise::registerGameObject(const Object* gameObject, const String gameObjectName)
 {
+	if (serverMode)
+	{
+		return true;
+	}
+
+	WWISE_COMMAND_SCOPE("register_game_obj");
+	WWISE_RECORD_CALL("register_game_obj", gameObject, gameObjectName);
+
 	AKASSERT(gameObject);
 	AKASSERT(!gameObjectName.empty());
 
@@ -359,14 +684,37 @@ bool Wwise::registerGameObject(const Object* gameObject, const String gameObject
 
 bool Wwise::unregisterGameObject(const Object* gameObject)
 {
+	if (serverMode)
+	{
+		removeServerGameSyncs(gameObject);
+		return true;
+	}
+
+	WWISE_COMMAND_SCOPE("unregister_game_obj");
+	WWISE_RECORD_CALL("unregister_game_obj", gameObject);
+
 	AKASSERT(gameObject);
 
+	roomResolver.removeGameObject(gameObject->get_instance_id());
+	environmentManager.removeGameObject(gameObject->get_instance_id());
+	occlusionManager.removeGameObject(gameObject->get_instance_id());
+	occlusionWorlds.erase(gameObject->get_instance_id());
+	emitterLod.removeGameObject(gameObject->get_instance_id());
+
 	return ERROR_CHECK(AK::SoundEngine::UnregisterGameObj(static_cast<AkGameObjectID>(gameObject->get_instance_id())),
 					   "Failed to unregister Game Object: " + String::num_int64(gameObject->get_instance_id()));
 }
 
 bool Wwise::setListeners(const Object* emitter, const Object* listener)
 {
+	if (serverMode)
+	{
+		return true;
+	}
+
+	WWISE_COMMAND_SCOPE("set_listeners");
+	WWISE_RECORD_CALL("set_listeners", emitter, listener);
+
 	static const int kNumLstnrsForEm = 1;
 	static const AkGameObjectID aLstnrsForEmitter[kNumLstnrsForEm] = {
 		static_cast<AkGameObjectID>(listener->get_instance_id())};
@@ -377,26 +725,40 @@ bool Wwise::setListeners(const Object* emitter, const Object* listener)
 
 bool Wwise::set3DPosition(const Object* gameObject, const Transform transform)
 {
-	AKASSERT(gameObject);
+	if (serverMode)
+	{
+		return true;
+	}
 
-	AkSoundPosition soundPos;
+	WWISE_COMMAND_SCOPE("set_3d_position");
+	WWISE_RECORD_CALL("set_3d_position", gameObject, transform);
 
-	AkVector position;
-	GetAkVector(transform, position, VectorType::POSITION);
-	AkVector forward;
-	GetAkVector(transform, forward, VectorType::FORWARD);
-	AkVector up;
-	GetAkVector(transform, up, VectorType::UP);
+	AKASSERT(gameObject);
 
-	soundPos.Set(position, forward, up);
+	roomResolver.setPosition(gameObject->get_instance_id(), transform.origin);
+	environmentManager.setPosition(gameObject->get_instance_id(), transform.origin);
+	occlusionManager.setPosition(gameObject->get_instance_id(), transform.origin);
 
-	return ERROR_CHECK(
-		AK::SoundEngine::SetPosition(static_cast<AkGameObjectID>(gameObject->get_instance_id()), soundPos),
-		"Game object ID " + String::num_int64(gameObject->get_instance_id()));
+	// Distant emitters are sent by updateEmitterLod at a lower rate, or not at all out of audible range
+	if (!emitterLod.setTransform(gameObject->get_instance_id(), transform))
+	{
+		return true;
+	}
+
+	return ERROR_CHECK(setSoundEnginePosition(static_cast<AkGameObjectID>(gameObject->get_instance_id()), transform),
+					   "Game object ID " + String::num_int64(gameObject->get_instance_id()));
 }
 
 bool Wwise::set2DPosition(const Object* gameObject, const Transform2D transform2D, const float zDepth)
 {
+	if (serverMode)
+	{
+		return true;
+	}
+
+	WWISE_COMMAND_SCOPE("set_2d_position");
+	WWISE_RECORD_CALL("set_2d_position", gameObject, transform2D, zDepth);
+
 	AKASSERT(gameObject);
 
 	AkSoundPosition soundPos;
@@ -423,6 +785,14 @@ bool Wwise::set2DPosition(const Object* gameObject, const Transform2D transform2
 
 unsigned int Wwise::postEvent(const String eventName, const Object* gameObject)
 {
+	if (serverMode)
+	{
+		return static_cast<unsigned int>(AK_INVALID_PLAYING_ID);
+	}
+
+	WWISE_COMMAND_SCOPE("post_event");
+	WWISE_RECORD_CALL("post_event", eventName, gameObject);
+
 	AKASSERT(!eventName.empty());
 	AKASSERT(gameObject);
 
@@ -439,6 +809,14 @@ unsigned int Wwise::postEvent(const String eventName, const Object* gameObject)
 
 unsigned int Wwise::postEventCallback(const String eventName, const unsigned int flags, const Object* gameObject)
 {
+	if (serverMode)
+	{
+		return static_cast<unsigned int>(AK_INVALID_PLAYING_ID);
+	}
+
+	WWISE_COMMAND_SCOPE("post_event_callback");
+	WWISE_RECORD_CALL("post_event_callback", eventName, flags, gameObject);
+
 	AKASSERT(!eventName.empty());
 	AKASSERT(gameObject);
 
@@ -455,6 +833,14 @@ unsigned int Wwise::postEventCallback(const String eventName, const unsigned int
 
 unsigned int Wwise::postEventID(const unsigned int eventID, const Object* gameObject)
 {
+	if (serverMode)
+	{
+		return static_cast<unsigned int>(AK_INVALID_PLAYING_ID);
+	}
+
+	WWISE_COMMAND_SCOPE("post_event_id");
+	WWISE_RECORD_CALL("post_event_id", eventID, gameObject);
+
 	AKASSERT(gameObject);
 
 	AkPlayingID playingID =
@@ -470,6 +856,14 @@ unsigned int Wwise::postEventID(const unsigned int eventID, const Object* gameOb
 
 unsigned int Wwise::postEventIDCallback(const unsigned int eventID, const unsigned int flags, const Object* gameObject)
 {
+	if (serverMode)
+	{
+		return static_cast<unsigned int>(AK_INVALID_PLAYING_ID);
+	}
+
+	WWISE_COMMAND_SCOPE("post_event_id_callback");
+	WWISE_RECORD_CALL("post_event_id_callback", eventID, flags, gameObject);
+
 	AKASSERT(gameObject);
 
 	AkPlayingID playingID = AK::SoundEngine::PostEvent(
@@ -483,8 +877,78 @@ unsigned int Wwise::postEventIDCallback(const unsigned int eventID, const unsign
 	return static_cast<unsigned int>(playingID);
 }
 
+unsigned int Wwise::postEventAtPosition(const unsigned int eventID, const Transform transform)
+{
+	if (serverMode)
+	{
+		return static_cast<unsigned int>(AK_INVALID_PLAYING_ID);
+	}
+
+	WWISE_COMMAND_SCOPE("post_event_at_position");
+	WWISE_RECORD_CALL("post_event_at_position", eventID, transform);
+
+	const AkGameObjectID gameObjectID = acquireTransientGameObject();
+
+	if (gameObjectID == AK_INVALID_GAME_OBJECT)
+	{
+		// Only warned about once, a burst of one-shots past the max would otherwise flood the output
+		if (droppedTransientEvents++ == 0)
+		{
+			Godot::print_warning("Every transient game object is playing, one-shots are dropped until one ends. "
+								 "Consider raising transient_game_objects/max_pool_size",
+								 __FUNCTION__, __FILE__, __LINE__);
+		}
+
+		return static_cast<unsigned int>(AK_INVALID_PLAYING_ID);
+	}
+
+	ERROR_CHECK(setSoundEnginePosition(gameObjectID, transform), "Failed to set transient game object position");
+
+	// Rooms are otherwise resolved in _process, after the one-shot would have started in the room of its last use
+	uint64_t roomID = WwiseRoomResolver::NO_ROOM;
+
+	if (roomResolver.resolveGameObject(gameObjectID, transform.origin, roomID))
+	{
+		sendGameObjectRoom(gameObjectID, roomID);
+	}
+
+	AkPlayingID playingID =
+		AK::SoundEngine::PostEvent(eventID, gameObjectID, AK_EndOfEvent, transientEventCallback, this);
+
+	if (playingID == AK_INVALID_PLAYING_ID)
+	{
+		AkAutoLock<CAkLock> scopedLock(transientGameObjectLock);
+		freeTransientGameObjects.push_back(gameObjectID);
+
+		ERROR_CHECK(AK_InvalidID, eventID);
+	}
+
+	return static_cast<unsigned int>(playingID);
+}
+
+Dictionary Wwise::getTransientGameObjectStats()
+{
+	AkAutoLock<CAkLock> scopedLock(transientGameObjectLock);
+
+	Dictionary transientStats;
+	transientStats["pool_size"] = static_cast<int>(transientGameObjectCount);
+	transientStats["in_use"] = static_cast<int>(transientGameObjectCount - freeTransientGameObjects.size());
+	transientStats["max_pool_size"] = static_cast<int>(maxTransientGameObjects);
+	transientStats["dropped"] = static_cast<int64_t>(droppedTransientEvents);
+
+	return transientStats;
+}
+
 bool Wwise::stopEvent(const int playingID, const int fadeTime, const int interpolation)
 {
+	if (serverMode)
+	{
+		return true;
+	}
+
+	WWISE_COMMAND_SCOPE("stop_event");
+	WWISE_RECORD_CALL("stop_event", playingID, fadeTime, interpolation);
+
 	AKASSERT(fadeTime >= 0);
 
 	AK::SoundEngine::ExecuteActionOnPlayingID(AK::SoundEngine::AkActionOnEventType::AkActionOnEventType_Stop,
@@ -496,9 +960,18 @@ bool Wwise::stopEvent(const int playingID, const int fadeTime, const int interpo
 
 bool Wwise::setSwitch(const String switchGroup, const String switchState, const Object* gameObject)
 {
-	AKASSERT(!switchGroup.empty());
-	AKASSERT(!switchState.empty());
-	AKASSERT(gameObject);
+	if (serverMode)
+	{
+		setServerGameSync(serverSwitches, gameObject, switchGroup, switchState);
+		return true;
+	}
+
+	WWISE_COMMAND_SCOPE("set_switch");
+	WWISE_RECORD_CALL("set_switch", switchGroup, switchState, gameObject);
+
+	AKASSERT(!switchGroup.empty());
+	AKASSERT(!switchState.empty());
+	AKASSERT(gameObject);
 
 	return ERROR_CHECK(AK::SoundEngine::SetSwitch(switchGroup.alloc_c_string(), switchState.alloc_c_string(),
 												  static_cast<AkGameObjectID>(gameObject->get_instance_id())),
@@ -507,6 +980,15 @@ bool Wwise::setSwitch(const String switchGroup, const String switchState, const
 
 bool Wwise::setSwitchID(const unsigned int switchGroupID, const unsigned int switchStateID, const Object* gameObject)
 {
+	if (serverMode)
+	{
+		setServerGameSync(serverSwitches, gameObject, switchGroupID, switchStateID);
+		return true;
+	}
+
+	WWISE_COMMAND_SCOPE("set_switch_id");
+	WWISE_RECORD_CALL("set_switch_id", switchGroupID, switchStateID, gameObject);
+
 	AKASSERT(gameObject);
 
 	return ERROR_CHECK(AK::SoundEngine::SetSwitch(switchGroupID, switchStateID,
@@ -517,6 +999,15 @@ bool Wwise::setSwitchID(const unsigned int switchGroupID, const unsigned int swi
 
 bool Wwise::setState(const String stateGroup, const String stateValue)
 {
+	if (serverMode)
+	{
+		serverStates[stateGroup] = stateValue;
+		return true;
+	}
+
+	WWISE_COMMAND_SCOPE("set_state");
+	WWISE_RECORD_CALL("set_state", stateGroup, stateValue);
+
 	AKASSERT(!stateGroup.empty());
 	AKASSERT(!stateValue.empty());
 
@@ -526,6 +1017,15 @@ bool Wwise::setState(const String stateGroup, const String stateValue)
 
 bool Wwise::setStateID(const unsigned int stateGroupID, const unsigned int stateValueID)
 {
+	if (serverMode)
+	{
+		serverStates[stateGroupID] = stateValueID;
+		return true;
+	}
+
+	WWISE_COMMAND_SCOPE("set_state_id");
+	WWISE_RECORD_CALL("set_state_id", stateGroupID, stateValueID);
+
 	return ERROR_CHECK(AK::SoundEngine::SetState(stateGroupID, stateValueID),
 					   "Failed to set state ID" + String::num_int64(stateGroupID) + " and value " +
 						   String::num_int64(stateValueID));
@@ -533,6 +1033,14 @@ bool Wwise::setStateID(const unsigned int stateGroupID, const unsigned int state
 
 float Wwise::getRTPCValue(const String rtpcName, const Object* gameObject)
 {
+	if (serverMode)
+	{
+		return getServerGameSync(serverRTPCs, gameObject, rtpcName, INVALID_RTPC_VALUE);
+	}
+
+	WWISE_PROFILE_SCOPE("get_rtpc");
+	WWISE_RECORD_CALL("get_rtpc", rtpcName, gameObject);
+
 	AKASSERT(!rtpcName.empty());
 	AkRtpcValue value;
 	AK::SoundEngine::Query::RTPCValue_type type = AK::SoundEngine::Query::RTPCValue_Default;
@@ -561,6 +1069,14 @@ float Wwise::getRTPCValue(const String rtpcName, const Object* gameObject)
 
 float Wwise::getRTPCValueID(const unsigned int rtpcID, const Object* gameObject)
 {
+	if (serverMode)
+	{
+		return getServerGameSync(serverRTPCs, gameObject, rtpcID, INVALID_RTPC_VALUE);
+	}
+
+	WWISE_PROFILE_SCOPE("get_rtpc_id");
+	WWISE_RECORD_CALL("get_rtpc_id", rtpcID, gameObject);
+
 	AkRtpcValue value;
 	AK::SoundEngine::Query::RTPCValue_type type = AK::SoundEngine::Query::RTPCValue_Default;
 	AkGameObjectID gameObjectID = AK_INVALID_GAME_OBJECT;
@@ -588,6 +1104,15 @@ float Wwise::getRTPCValueID(const unsigned int rtpcID, const Object* gameObject)
 
 bool Wwise::setRTPCValue(const String rtpcName, const float rtpcValue, const Object* gameObject)
 {
+	if (serverMode)
+	{
+		setServerGameSync(serverRTPCs, gameObject, rtpcName, rtpcValue);
+		return true;
+	}
+
+	WWISE_COMMAND_SCOPE("set_rtpc");
+	WWISE_RECORD_CALL("set_rtpc", rtpcName, rtpcValue, gameObject);
+
 	AKASSERT(!rtpcName.empty());
 	AkGameObjectID gameObjectID = AK_INVALID_GAME_OBJECT;
 
@@ -607,6 +1132,15 @@ bool Wwise::setRTPCValue(const String rtpcName, const float rtpcValue, const Obj
 
 bool Wwise::setRTPCValueID(const unsigned int rtpcID, const float rtpcValue, const Object* gameObject)
 {
+	if (serverMode)
+	{
+		setServerGameSync(serverRTPCs, gameObject, rtpcID, rtpcValue);
+		return true;
+	}
+
+	WWISE_COMMAND_SCOPE("set_rtpc_id");
+	WWISE_RECORD_CALL("set_rtpc_id", rtpcID, rtpcValue, gameObject);
+
 	AkGameObjectID gameObjectID = AK_INVALID_GAME_OBJECT;
 
 	if (gameObject)
@@ -624,6 +1158,14 @@ bool Wwise::setRTPCValueID(const unsigned int rtpcID, const float rtpcValue, con
 
 bool Wwise::postTrigger(const String triggerName, const Object* gameObject)
 {
+	if (serverMode)
+	{
+		return true;
+	}
+
+	WWISE_COMMAND_SCOPE("post_trigger");
+	WWISE_RECORD_CALL("post_trigger", triggerName, gameObject);
+
 	AKASSERT(!triggerName.empty());
 	AKASSERT(gameObject);
 
@@ -634,6 +1176,14 @@ bool Wwise::postTrigger(const String triggerName, const Object* gameObject)
 
 bool Wwise::postTriggerID(const unsigned int triggerID, const Object* gameObject)
 {
+	if (serverMode)
+	{
+		return true;
+	}
+
+	WWISE_COMMAND_SCOPE("post_trigger_id");
+	WWISE_RECORD_CALL("post_trigger_id", triggerID, gameObject);
+
 	AKASSERT(gameObject);
 
 	return ERROR_CHECK(
@@ -644,6 +1194,14 @@ bool Wwise::postTriggerID(const unsigned int triggerID, const Object* gameObject
 unsigned int Wwise::postExternalSource(const String eventName, const Object* gameObject, const String sourceObjectName,
 									   const String fileName, const unsigned int idCodec)
 {
+	if (serverMode)
+	{
+		return static_cast<unsigned int>(AK_INVALID_PLAYING_ID);
+	}
+
+	WWISE_COMMAND_SCOPE("post_external_source");
+	WWISE_RECORD_CALL("post_external_source", eventName, gameObject, sourceObjectName, fileName, idCodec);
+
 	AKASSERT(!eventName.empty());
 	AKASSERT(gameObject);
 	AKASSERT(!sourceObjectName.empty());
@@ -676,6 +1234,14 @@ unsigned int Wwise::postExternalSourceID(const unsigned int eventID, const Objec
 										 const unsigned int sourceObjectID, const String fileName,
 										 const unsigned int idCodec)
 {
+	if (serverMode)
+	{
+		return static_cast<unsigned int>(AK_INVALID_PLAYING_ID);
+	}
+
+	WWISE_COMMAND_SCOPE("post_external_source_id");
+	WWISE_RECORD_CALL("post_external_source_id", eventID, gameObject, sourceObjectID, fileName, idCodec);
+
 	AKASSERT(gameObject);
 	AKASSERT(!fileName.empty());
 
@@ -703,6 +1269,14 @@ unsigned int Wwise::postExternalSourceID(const unsigned int eventID, const Objec
 
 int Wwise::getSourcePlayPosition(const unsigned int playingID, const bool extrapolate)
 {
+	if (serverMode)
+	{
+		return static_cast<int>(AK_INVALID_PLAYING_ID);
+	}
+
+	WWISE_PROFILE_SCOPE("get_source_play_position");
+	WWISE_RECORD_CALL("get_source_play_position", playingID, extrapolate);
+
 	AkTimeMs position;
 	AKRESULT result =
 		AK::SoundEngine::GetSourcePlayPosition(static_cast<AkPlayingID>(playingID), &position, extrapolate);
@@ -718,6 +1292,14 @@ int Wwise::getSourcePlayPosition(const unsigned int playingID, const bool extrap
 
 Dictionary Wwise::getPlayingSegmentInfo(const unsigned int playingID, const bool extrapolate)
 {
+	if (serverMode)
+	{
+		return Dictionary();
+	}
+
+	WWISE_PROFILE_SCOPE("get_playing_segment_info");
+	WWISE_RECORD_CALL("get_playing_segment_info", playingID, extrapolate);
+
 	AkSegmentInfo segmentInfo;
 	AKRESULT result =
 		AK::MusicEngine::GetPlayingSegmentInfo(static_cast<AkPlayingID>(playingID), segmentInfo, extrapolate);
@@ -744,6 +1326,14 @@ Dictionary Wwise::getPlayingSegmentInfo(const unsigned int playingID, const bool
 bool Wwise::setGameObjectOutputBusVolume(const unsigned int gameObjectID, const unsigned int listenerID,
 										 float fControlValue)
 {
+	if (serverMode)
+	{
+		return true;
+	}
+
+	WWISE_COMMAND_SCOPE("set_game_obj_output_bus_volume");
+	WWISE_RECORD_CALL("set_game_obj_output_bus_volume", gameObjectID, listenerID, fControlValue);
+
 	return ERROR_CHECK(AK::SoundEngine::SetGameObjectOutputBusVolume(static_cast<AkGameObjectID>(gameObjectID),
 																	 static_cast<AkGameObjectID>(listenerID),
 																	 fControlValue),
@@ -753,6 +1343,14 @@ bool Wwise::setGameObjectOutputBusVolume(const unsigned int gameObjectID, const
 bool Wwise::setGameObjectAuxSendValues(const unsigned int gameObjectID, const Array akAuxSendValues,
 									   const unsigned int sendValues)
 {
+	if (serverMode)
+	{
+		return true;
+	}
+
+	WWISE_COMMAND_SCOPE("set_game_obj_aux_send_values");
+	WWISE_RECORD_CALL("set_game_obj_aux_send_values", gameObjectID, akAuxSendValues, sendValues);
+
 	AkAuxSendValue environments[AK_MAX_ENVIRONMENTS];
 
 	for (int i = 0; i < akAuxSendValues.size(); i++)
@@ -771,645 +1369,2430 @@ bool Wwise::setGameObjectAuxSendValues(const unsigned int gameObjectID, const Ar
 bool Wwise::setObjectObstructionAndOcclusion(const unsigned int gameObjectID, const unsigned int listenerID,
 											 float fCalculatedObs, float fCalculatedOcc)
 {
+	if (serverMode)
+	{
+		return true;
+	}
+
+	WWISE_COMMAND_SCOPE("set_obj_obstruction_and_occlusion");
+	WWISE_RECORD_CALL("set_obj_obstruction_and_occlusion", gameObjectID, listenerID, fCalculatedObs, fCalculatedOcc);
+
 	return ERROR_CHECK(AK::SoundEngine::SetObjectObstructionAndOcclusion(static_cast<AkGameObjectID>(gameObjectID),
 																		 static_cast<AkGameObjectID>(listenerID),
 																		 fCalculatedObs, fCalculatedOcc),
 					   "Could not set Obstruction and Occlusion");
 }
 
-bool Wwise::setGeometry(const Array vertices, const Array triangles, const Resource* acousticTexture,
-						const float occlusionValue, const Object* gameObject, bool enableDiffraction,
-						bool enableDiffractionOnBoundaryEdges, const Object* associatedRoom)
+bool Wwise::addEnvironmentZone(const Object* zone, const unsigned int auxBusID, const Transform transform,
+							   const Vector3 extents, const int priority, const float fadeDistance)
 {
-	AKASSERT(!vertices.empty());
-	AKASSERT(!triangles.empty());
-	AKASSERT(gameObject);
+	if (serverMode)
+	{
+		return true;
+	}
 
-	AkGeometryParams geometry;
+	WWISE_COMMAND_SCOPE("add_environment_zone");
+	WWISE_RECORD_CALL("add_environment_zone", zone, auxBusID, transform, extents, priority, fadeDistance);
 
-	int vertexCount = vertices.size();
-	auto vertRemap = std::make_unique<int[]>(vertexCount);
-	PoolVector3Array uniqueVerts;
-	Dictionary vertDict;
+	AKASSERT(zone);
 
-	// removing duplicate verts
-	for (int v = 0; v < vertexCount; ++v)
+	if (extents.x <= 0.0f || extents.y <= 0.0f || extents.z <= 0.0f || fadeDistance < 0.0f)
 	{
-		int vertIdx = 0;
-
-		if (!FindMatchingVertex(vertices[v], vertDict, vertIdx))
-		{
-			vertIdx = uniqueVerts.size();
-			uniqueVerts.append(vertices[v]);
-			vertDict[vertices[v]] = vertIdx;
-		}
-		vertRemap[v] = vertIdx;
+		Godot::print_error("Environment zone of " + String::num_int64(zone->get_instance_id()) +
+							   " needs positive extents and fade distance",
+						   __FUNCTION__, __FILE__, __LINE__);
+		return false;
 	}
 
-	vertexCount = uniqueVerts.size();
-	auto akVertices = std::make_unique<AkVertex[]>(vertexCount);
+	// Environment aware game objects get their aux sends from their position, see updateEnvironments
+	environmentManager.addZone(zone->get_instance_id(), auxBusID, transform, extents, priority, fadeDistance);
 
-	for (int i = 0; i < vertexCount; i++)
-	{
-		Vector3 point = uniqueVerts[i];
-		AkVertex v;
-		v.X = -point.x; // Seems to be flipped in Wwise otherwise
-		v.Y = point.y;
-		v.Z = point.z;
+	return true;
+}
 
-		akVertices[i] = v;
+bool Wwise::removeEnvironmentZone(const Object* zone)
+{
+	if (serverMode)
+	{
+		return true;
 	}
 
-	int numTriangles = triangles.size() / 3;
+	WWISE_COMMAND_SCOPE("remove_environment_zone");
+	WWISE_RECORD_CALL("remove_environment_zone", zone);
+
+	AKASSERT(zone);
+
+	environmentManager.removeZone(zone->get_instance_id());
 
-	if ((numTriangles % 3) != 0)
+	return true;
+}
+
+bool Wwise::setGameObjectEnvironmentAware(const Object* gameObject, const bool enabled)
+{
+	if (serverMode)
 	{
-		Godot::print("Wrong number of triangles on mesh {0}", String::num_int64(gameObject->get_instance_id()));
+		return true;
 	}
 
-	auto akTriangles = std::make_unique<AkTriangle[]>(numTriangles);
+	WWISE_COMMAND_SCOPE("set_game_obj_environment_aware");
+	WWISE_RECORD_CALL("set_game_obj_environment_aware", gameObject, enabled);
 
-	if (acousticTexture)
+	AKASSERT(gameObject);
+
+	environmentManager.setEnvironmentAware(gameObject->get_instance_id(), enabled);
+
+	if (!enabled)
 	{
-		AkAcousticSurface akSurfaces[1];
+		// Sends set from the zones would otherwise stay on the game object
+		return ERROR_CHECK(AK::SoundEngine::SetGameObjectAuxSendValues(
+							   static_cast<AkGameObjectID>(gameObject->get_instance_id()), nullptr, 0),
+						   "Could not clear the Game Object Aux Send Values");
+	}
 
-		geometry.NumSurfaces = 1;
+	return true;
+}
 
-		AkAcousticTexture akAcousticTexture;
-		String acousticTextureName = acousticTexture->get("name");
-		akAcousticTexture.ID = AK::SoundEngine::GetIDFromString(acousticTextureName.alloc_c_string());
+Array Wwise::getGameObjectAuxSends(const Object* gameObject)
+{
+	AKASSERT(gameObject);
 
-		// Not possible to get the acoustic texture values through AK::SoundEngine, maybe looking at WAAPI
-		akAcousticTexture.fAbsorptionHigh = static_cast<float>(acousticTexture->get("absorption_high"));
-		akAcousticTexture.fAbsorptionLow = static_cast<float>(acousticTexture->get("absorption_low"));
-		akAcousticTexture.fAbsorptionMidHigh = static_cast<float>(acousticTexture->get("absorption_mid_high"));
-		akAcousticTexture.fAbsorptionMidLow = static_cast<float>(acousticTexture->get("absorption_mid_low"));
-		akAcousticTexture.fAbsorptionOffset = static_cast<float>(acousticTexture->get("absorption_offset"));
-		akAcousticTexture.fScattering = static_cast<float>(acousticTexture->get("scattering"));
+	WwiseEnvironmentManager::Send sends[WwiseEnvironmentManager::MAX_SENDS];
+	const int sendCount = environmentManager.getSends(gameObject->get_instance_id(), sends);
 
-		akSurfaces[0].textureID = akAcousticTexture.ID;
-		akSurfaces[0].occlusion = occlusionValue;
-		akSurfaces[0].strName = acousticTextureName.alloc_c_string();
+	Array auxSends;
 
-		geometry.Surfaces = akSurfaces;
+	for (int i = 0; i < sendCount; ++i)
+	{
+		Dictionary auxBusData;
+		auxBusData["aux_bus_id"] = sends[i].auxBusID;
+		auxBusData["control_value"] = sends[i].controlValue;
+		auxSends.append(auxBusData);
 	}
 
-	int triangleIdx = 0;
+	return auxSends;
+}
 
-	for (int i = 0; i < numTriangles; i++)
+bool Wwise::setGameObjectOcclusion(const Object* emitter, const Object* listener, const int priority)
+{
+	if (serverMode)
 	{
-		AkTriangle t;
-		t.point0 = vertRemap[static_cast<unsigned int>(triangles[3 * i + 0])];
-		t.point1 = vertRemap[static_cast<unsigned int>(triangles[3 * i + 1])];
-		t.point2 = vertRemap[static_cast<unsigned int>(triangles[3 * i + 2])];
-		t.surface = acousticTexture ? 0 : AK_INVALID_SURFACE;
+		return true;
+	}
 
-		akTriangles[triangleIdx] = t;
+	WWISE_COMMAND_SCOPE("set_game_obj_occlusion");
+	WWISE_RECORD_CALL("set_game_obj_occlusion", emitter, listener, priority);
 
-		if (t.point0 != t.point1 && t.point0 != t.point2 && t.point1 != t.point2)
-		{
-			++triangleIdx;
-		}
-		else
-		{
-			Godot::print("Skipped degenerate triangles on mesh {0}", String::num_int64(gameObject->get_instance_id()));
-		}
+	AKASSERT(emitter);
+	AKASSERT(listener);
+
+	const Spatial* spatial = Object::cast_to<Spatial>(emitter);
+
+	if (!spatial || !spatial->is_inside_tree())
+	{
+		Godot::print_error("Occlusion of " + String::num_int64(emitter->get_instance_id()) +
+							   " needs a Spatial emitter inside the scene tree",
+						   __FUNCTION__, __FILE__, __LINE__);
+		return false;
 	}
 
-	geometry.Vertices = akVertices.get();
-	geometry.NumVertices = vertexCount;
-	geometry.Triangles = akTriangles.get();
-	geometry.NumTriangles = triangleIdx;
+	// Rays are cast in the World of the emitter, the listener only provides the other end of the ray
+	occlusionWorlds[emitter->get_instance_id()] = spatial->get_world();
+	occlusionManager.addEmitter(emitter->get_instance_id(), listener->get_instance_id(), priority);
+	set_physics_process(true);
 
-	geometry.EnableDiffraction = enableDiffraction;
-	geometry.EnableDiffractionOnBoundaryEdges = enableDiffractionOnBoundaryEdges;
-	geometry.RoomID = associatedRoom ? static_cast<AkRoomID>(associatedRoom->get_instance_id()) : AkRoomID();
+	return true;
+}
 
-	return ERROR_CHECK(
-		AK::SpatialAudio::SetGeometry(static_cast<AkGeometrySetID>(gameObject->get_instance_id()), geometry),
-		"Failed to register geometry");
+bool Wwise::removeGameObjectOcclusion(const Object* emitter)
+{
+	if (serverMode)
+	{
+		return true;
+	}
+
+	WWISE_COMMAND_SCOPE("remove_game_obj_occlusion");
+	WWISE_RECORD_CALL("remove_game_obj_occlusion", emitter);
+
+	AKASSERT(emitter);
+
+	occlusionWorlds.erase(emitter->get_instance_id());
+
+	return occlusionManager.removeEmitter(emitter->get_instance_id());
 }
 
-bool Wwise::removeGeometry(const Object* gameObject)
+float Wwise::getGameObjectOcclusion(const Object* emitter)
 {
-	AKASSERT(gameObject);
+	AKASSERT(emitter);
+
+	float occlusion = 0.0f;
+	occlusionManager.getOcclusion(emitter->get_instance_id(), occlusion);
 
-	return ERROR_CHECK(AK::SpatialAudio::RemoveGeometry(static_cast<AkGeometrySetID>(gameObject->get_instance_id())),
-					   "Failed to remove geometry");
+	return occlusion;
 }
 
-bool Wwise::registerSpatialListener(const Object* gameObject)
+bool Wwise::setGameObjectMaxRadius(const Object* gameObject, const float maxRadius)
 {
+	if (serverMode)
+	{
+		return true;
+	}
+
+	WWISE_COMMAND_SCOPE("set_game_obj_max_radius");
+	WWISE_RECORD_CALL("set_game_obj_max_radius", gameObject, maxRadius);
+
 	AKASSERT(gameObject);
 
-	return ERROR_CHECK(AK::SpatialAudio::RegisterListener(static_cast<AkGameObjectID>(gameObject->get_instance_id())),
-					   "Failed to register Spatial Audio Listener");
+	const uint64_t gameObjectID = gameObject->get_instance_id();
+	const Transform* transform = emitterLod.getTransform(gameObjectID);
+	const bool pending = transform && emitterLod.getTier(gameObjectID) != WwiseEmitterLod::TIER_FULL;
+
+	// Without a radius the emitter is no longer culled, its last skipped transform is sent before it stops being kept
+	if (maxRadius <= 0.0f && pending)
+	{
+		ERROR_CHECK(setSoundEnginePosition(static_cast<AkGameObjectID>(gameObjectID), *transform),
+					"Game object ID " + String::num_int64(gameObjectID));
+		occlusionManager.setActive(gameObjectID, true);
+	}
+
+	emitterLod.setEmitter(gameObjectID, maxRadius);
+
+	return true;
 }
 
-bool Wwise::setRoom(const Object* gameObject, const unsigned int akAuxBusID, const String gameObjectName)
+int Wwise::getGameObjectLodTier(const Object* gameObject)
 {
 	AKASSERT(gameObject);
 
-	AkRoomParams roomParams;
-	roomParams.ReverbAuxBus = akAuxBusID;
-	roomParams.strName = gameObjectName.alloc_c_string();
-	return ERROR_CHECK(AK::SpatialAudio::SetRoom(static_cast<AkRoomID>(gameObject->get_instance_id()), roomParams),
-					   "Failed to set Room for Game Object: " + String::num_int64(gameObject->get_instance_id()));
+	return static_cast<int>(emitterLod.getTier(gameObject->get_instance_id()));
 }
 
-bool Wwise::removeRoom(const Object* gameObject)
+Dictionary Wwise::getEmitterLodStats()
 {
-	return ERROR_CHECK(AK::SpatialAudio::RemoveRoom(static_cast<AkRoomID>(gameObject->get_instance_id())),
-					   "Failed to remove Room for Game Object: " + String::num_int64(gameObject->get_instance_id()));
+	const WwiseEmitterLod::Stats& stats = emitterLod.getStats();
+
+	Dictionary lodStats;
+	lodStats["full"] = stats.tierCounts[WwiseEmitterLod::TIER_FULL];
+	lodStats["reduced"] = stats.tierCounts[WwiseEmitterLod::TIER_REDUCED];
+	lodStats["suspended"] = stats.tierCounts[WwiseEmitterLod::TIER_SUSPENDED];
+	lodStats["positions_sent"] = stats.positionsSent;
+	lodStats["positions_skipped"] = stats.positionsSkipped;
+
+	return lodStats;
 }
 
-bool Wwise::setPortal(const Object* gameObject, const Transform transform, const Vector3 extent,
-					  const Object* frontRoom, const Object* backRoom, bool enabled, const String portalName)
+bool Wwise::setClusteredEmitter(const Object* emitter, const unsigned int eventID, const Transform transform)
 {
-	AKASSERT(gameObject);
+	if (serverMode)
+	{
+		return true;
+	}
 
-	AkVector position;
-	GetAkVector(transform, position, VectorType::POSITION);
-	AkVector forward;
-	GetAkVector(transform, forward, VectorType::FORWARD);
-	AkVector up;
-	GetAkVector(transform, up, VectorType::UP);
+	WWISE_COMMAND_SCOPE("set_clustered_emitter");
+	WWISE_RECORD_CALL("set_clustered_emitter", emitter, eventID, transform);
 
-	AkTransform akTransform;
-	akTransform.Set(position, forward, up);
+	AKASSERT(emitter);
 
-	AkVector akExtent;
-	Vector3ToAkVector(extent, akExtent);
+	// The emitter is not a game object of its own, it is played by its cluster, see updateEmitterClusters
+	emitterClusters.setEmitter(emitter->get_instance_id(), eventID, transform);
 
-	AkRoomID roomID;
+	return true;
+}
 
-	AkPortalParams portalParams;
-	portalParams.Transform = akTransform;
-	portalParams.Extent = akExtent;
-	portalParams.FrontRoom =
-		frontRoom ? static_cast<AkRoomID>(frontRoom->get_instance_id()) : static_cast<AkRoomID>(INVALID_ROOM_ID);
-	portalParams.BackRoom =
-		backRoom ? static_cast<AkRoomID>(backRoom->get_instance_id()) : static_cast<AkRoomID>(INVALID_ROOM_ID);
-	portalParams.bEnabled = enabled;
-	portalParams.strName = portalName.alloc_c_string();
+bool Wwise::removeClusteredEmitter(const Object* emitter)
+{
+	if (serverMode)
+	{
+		return true;
+	}
 
-	return ERROR_CHECK(
-		AK::SpatialAudio::SetPortal(static_cast<AkPortalID>(gameObject->get_instance_id()), portalParams),
-		"Failed to set Portal on GameObject: " + String::num_int64(gameObject->get_instance_id()));
+	WWISE_COMMAND_SCOPE("remove_clustered_emitter");
+	WWISE_RECORD_CALL("remove_clustered_emitter", emitter);
+
+	AKASSERT(emitter);
+
+	return emitterClusters.removeEmitter(emitter->get_instance_id());
 }
 
-bool Wwise::removePortal(const Object* gameObject)
+int64_t Wwise::getEmitterCluster(const Object* emitter)
 {
-	AKASSERT(gameObject);
-	return ERROR_CHECK(AK::SpatialAudio::RemovePortal(static_cast<AkPortalID>(gameObject->get_instance_id())),
-					   "Failed to remove Portal for Game Object: " + String::num_int64(gameObject->get_instance_id()));
+	AKASSERT(emitter);
+
+	return static_cast<int64_t>(emitterClusters.getCluster(emitter->get_instance_id()));
 }
 
-bool Wwise::setGameObjectInRoom(const Object* gameObject, const Object* room)
+int Wwise::getEmitterClusterCount()
 {
-	AKASSERT(gameObject);
-	AKASSERT(room);
-	return ERROR_CHECK(AK::SpatialAudio::SetGameObjectInRoom(static_cast<AkGameObjectID>(gameObject->get_instance_id()),
-															 static_cast<AkRoomID>(room->get_instance_id())),
-					   "Failed to set Game Object in Room: " + String::num_int64(room->get_instance_id()));
+	return static_cast<int>(emitterClusters.getClusterCount());
 }
 
-bool Wwise::removeGameObjectFromRoom(const Object* gameObject)
+bool Wwise::setGeometry(const PoolVector3Array vertices, const PoolIntArray triangles,
+						const Resource* acousticTexture, const float occlusionValue, const Object* gameObject,
+						bool enableDiffraction, bool enableDiffractionOnBoundaryEdges, const Object* associatedRoom)
 {
+	if (serverMode)
+	{
+		return true;
+	}
+
+	WWISE_COMMAND_SCOPE("set_geometry");
+	WWISE_RECORD_CALL("set_geometry", vertices, triangles, acousticTexture, occlusionValue, gameObject,
+					  enableDiffraction, enableDiffractionOnBoundaryEdges, associatedRoom);
+
+	AKASSERT(vertices.size() > 0);
+	AKASSERT(triangles.size() > 0);
 	AKASSERT(gameObject);
 
-	return ERROR_CHECK(AK::SpatialAudio::SetGameObjectInRoom(static_cast<AkGameObjectID>(gameObject->get_instance_id()),
-															 INVALID_ROOM_ID),
-					   "Failed to remove Game Object from Room: " + String::num_int64(gameObject->get_instance_id()));
+	if ((triangles.size() % 3) != 0)
+	{
+		Godot::print("Wrong number of triangle indices on mesh {0}", String::num_int64(gameObject->get_instance_id()));
+	}
+
+	return submitGeometry(vertices, triangles, std::vector<AkSurfIdx>(), 1, Transform(), acousticTexture, Array(),
+						  occlusionValue, gameObject, enableDiffraction, enableDiffractionOnBoundaryEdges,
+						  associatedRoom, false);
 }
 
-bool Wwise::setEarlyReflectionsAuxSend(const Object* gameObject, const unsigned int auxBusID)
+bool Wwise::setGeometryAsync(const PoolVector3Array vertices, const PoolIntArray triangles,
+							 const Resource* acousticTexture, const float occlusionValue, const Object* gameObject,
+							 bool enableDiffraction, bool enableDiffractionOnBoundaryEdges,
+							 const Object* associatedRoom)
 {
+	if (serverMode)
+	{
+		return true;
+	}
+
+	WWISE_COMMAND_SCOPE("set_geometry_async");
+	WWISE_RECORD_CALL("set_geometry_async", vertices, triangles, acousticTexture, occlusionValue, gameObject,
+					  enableDiffraction, enableDiffractionOnBoundaryEdges, associatedRoom);
+
+	AKASSERT(vertices.size() > 0);
+	AKASSERT(triangles.size() > 0);
 	AKASSERT(gameObject);
 
-	return ERROR_CHECK(
-		AK::SpatialAudio::SetEarlyReflectionsAuxSend(static_cast<AkGameObjectID>(gameObject->get_instance_id()),
-													 static_cast<AkAuxBusID>(auxBusID)),
-		"Failed to set Early Reflections Aux Send");
+	// The arrays are copy on write, the job keeps the contents they have now
+	return submitGeometry(vertices, triangles, std::vector<AkSurfIdx>(), 1, Transform(), acousticTexture, Array(),
+						  occlusionValue, gameObject, enableDiffraction, enableDiffractionOnBoundaryEdges,
+						  associatedRoom, true);
 }
 
-bool Wwise::setEarlyReflectionsVolume(const Object* gameObject, const float volume)
+bool Wwise::setGeometryWithSurfaces(const PoolVector3Array vertices, const PoolIntArray triangles,
+									const PoolIntArray triangleSurfaces, const Array acousticTextures,
+									const float occlusionValue, const Object* gameObject, bool enableDiffraction,
+									bool enableDiffractionOnBoundaryEdges, const Object* associatedRoom)
 {
+	if (serverMode)
+	{
+		return true;
+	}
+
+	WWISE_COMMAND_SCOPE("set_geometry_with_surfaces");
+	WWISE_RECORD_CALL("set_geometry_with_surfaces", vertices, triangles, triangleSurfaces, acousticTextures,
+					  occlusionValue, gameObject, enableDiffraction, enableDiffractionOnBoundaryEdges, associatedRoom);
+
+	AKASSERT(vertices.size() > 0);
+	AKASSERT(triangles.size() > 0);
 	AKASSERT(gameObject);
 
-	return ERROR_CHECK(
-		AK::SpatialAudio::SetEarlyReflectionsVolume(static_cast<AkGameObjectID>(gameObject->get_instance_id()), volume),
-		"Failed to set Early Reflections volume");
-}
+	const int surfaceCount = acousticTextures.size();
 
-bool Wwise::addOutput(const String shareSet, const unsigned int outputID)
-{
-	AkOutputSettings outputSettings(shareSet.alloc_c_string(), outputID);
+	if (surfaceCount == 0 || surfaceCount > std::numeric_limits<AkSurfIdx>::max() ||
+		triangleSurfaces.size() != triangles.size() / 3)
+	{
+		Godot::print_error("Mesh " + String::num_int64(gameObject->get_instance_id()) +
+							   " needs one surface index per triangle and one acoustic texture per surface",
+						   __FUNCTION__, __FILE__, __LINE__);
+		return false;
+	}
 
-	return ERROR_CHECK(AK::SoundEngine::AddOutput(outputSettings),
-					   "Failed to add share set to output ID: " + String::num_int64(outputID));
-}
+	std::vector<AkSurfIdx> surfaces(triangleSurfaces.size());
 
-bool Wwise::removeOutput(const unsigned int outputID)
-{
-	return ERROR_CHECK(AK::SoundEngine::RemoveOutput(outputID),
-					   "Failed to remove output ID: " + String::num_int64(outputID));
+	{
+		const PoolIntArray::Read triangleSurfacesRead = triangleSurfaces.read();
+		const int* surfaceIndices = triangleSurfacesRead.ptr();
+
+		for (size_t i = 0; i < surfaces.size(); ++i)
+		{
+			if (surfaceIndices[i] < 0 || surfaceIndices[i] >= surfaceCount)
+			{
+				Godot::print_error("Triangle " + String::num_int64(i) + " of mesh " +
+									   String::num_int64(gameObject->get_instance_id()) +
+									   " uses a surface without an acoustic texture",
+								   __FUNCTION__, __FILE__, __LINE__);
+				return false;
+			}
+
+			surfaces[i] = static_cast<AkSurfIdx>(surfaceIndices[i]);
+		}
+	}
+
+	return submitGeometry(vertices, triangles, surfaces, surfaceCount, Transform(), nullptr, acousticTextures,
+						  occlusionValue, gameObject, enableDiffraction, enableDiffractionOnBoundaryEdges,
+						  associatedRoom, false);
 }
 
-bool Wwise::suspend(bool renderAnyway)
+bool Wwise::setGeometryFromMesh(const Mesh* mesh, const Transform transform, const Resource* acousticTexture,
+								const Array surfaceTextures, const float occlusionValue, const Object* gameObject,
+								bool enableDiffraction, bool enableDiffractionOnBoundaryEdges,
+								const Object* associatedRoom)
 {
-	return ERROR_CHECK(AK::SoundEngine::Suspend(renderAnyway), "Failed to suspend SoundEngine");
+	if (serverMode)
+	{
+		return true;
+	}
+
+	WWISE_COMMAND_SCOPE("set_geometry_from_mesh");
+	WWISE_RECORD_CALL("set_geometry_from_mesh", mesh, transform, acousticTexture, surfaceTextures, occlusionValue,
+					  gameObject, enableDiffraction, enableDiffractionOnBoundaryEdges, associatedRoom);
+
+	return submitMeshGeometry(mesh, transform, acousticTexture, surfaceTextures, occlusionValue, gameObject,
+							  enableDiffraction, enableDiffractionOnBoundaryEdges, associatedRoom, false);
 }
 
-bool Wwise::wakeupFromSuspend()
+bool Wwise::setGeometryFromMeshAsync(const Mesh* mesh, const Transform transform, const Resource* acousticTexture,
+									 const Array surfaceTextures, const float occlusionValue, const Object* gameObject,
+									 bool enableDiffraction, bool enableDiffractionOnBoundaryEdges,
+									 const Object* associatedRoom)
 {
-	return ERROR_CHECK(AK::SoundEngine::WakeupFromSuspend(), "Failed to wake up SoundEngine from suspend");
+	if (serverMode)
+	{
+		return true;
+	}
+
+	WWISE_COMMAND_SCOPE("set_geometry_from_mesh_async");
+	WWISE_RECORD_CALL("set_geometry_from_mesh_async", mesh, transform, acousticTexture, surfaceTextures,
+					  occlusionValue, gameObject, enableDiffraction, enableDiffractionOnBoundaryEdges, associatedRoom);
+
+	return submitMeshGeometry(mesh, transform, acousticTexture, surfaceTextures, occlusionValue, gameObject,
+							  enableDiffraction, enableDiffractionOnBoundaryEdges, associatedRoom, true);
 }
 
-void Wwise::eventCallback(AkCallbackType callbackType, AkCallbackInfo* callbackInfo)
+bool Wwise::setGeometryFromBaked(const PoolByteArray bakedGeometry, const Transform transform,
+								 const Resource* acousticTexture, const Array surfaceTextures,
+								 const float occlusionValue, const Object* gameObject, bool enableDiffraction,
+								 bool enableDiffractionOnBoundaryEdges, const Object* associatedRoom)
 {
-	AkAutoLock<CAkLock> ScopedLock(signalDataLock);
+	if (serverMode)
+	{
+		return true;
+	}
 
-	Dictionary signalData;
-	signalData["callbackType"] = static_cast<unsigned int>(callbackType);
+	WWISE_COMMAND_SCOPE("set_geometry_from_baked");
+	WWISE_RECORD_CALL("set_geometry_from_baked", bakedGeometry, transform, acousticTexture, surfaceTextures,
+					  occlusionValue, gameObject, enableDiffraction, enableDiffractionOnBoundaryEdges, associatedRoom);
 
-	switch (callbackType)
-	{
-	case AK_EndOfEvent:
+	AKASSERT(gameObject);
+
+	WwiseCachedGeometry geometry;
+
+	if (!WwiseGeometryBuilder::deserialize(bakedGeometry, geometry.data))
 	{
-		AkEventCallbackInfo* eventInfo = static_cast<AkEventCallbackInfo*>(callbackInfo);
-		signalData["eventID"] = static_cast<unsigned int>(eventInfo->eventID);
-		signalData["gameObjID"] = static_cast<unsigned int>(eventInfo->gameObjID);
-		signalData["playingID"] = static_cast<unsigned int>(eventInfo->playingID);
-		break;
+		Godot::print_error("Invalid baked geometry for game object " +
+							   String::num_int64(gameObject->get_instance_id()) + ", bake it again",
+						   __FUNCTION__, __FILE__, __LINE__);
+		return false;
 	}
-	case AK_EndOfDynamicSequenceItem:
+
+	const AkGeometrySetID geometrySetID = static_cast<AkGeometrySetID>(gameObject->get_instance_id());
+
+	cancelGeometryJob(geometrySetID);
+	prepareGeometry(geometry, transform, acousticTexture, surfaceTextures, occlusionValue, enableDiffraction,
+					enableDiffractionOnBoundaryEdges, associatedRoom);
+
+	return cacheGeometry(geometrySetID, geometry);
+}
+
+bool Wwise::setGeometryTransform(const Object* gameObject, const Transform transform)
+{
+	if (serverMode)
 	{
-		AkDynamicSequenceItemCallbackInfo* dynamicSequenceItemInfo =
-			static_cast<AkDynamicSequenceItemCallbackInfo*>(callbackInfo);
-		signalData["audioNodeID"] = static_cast<unsigned int>(dynamicSequenceItemInfo->audioNodeID);
-		signalData["gameObjID"] = static_cast<unsigned int>(dynamicSequenceItemInfo->gameObjID);
-		signalData["playingID"] = static_cast<unsigned int>(dynamicSequenceItemInfo->playingID);
-		break;
+		return true;
 	}
-	case AK_Marker:
+
+	WWISE_PROFILE_SCOPE("set_geometry_transform");
+	WWISE_RECORD_CALL("set_geometry_transform", gameObject, transform);
+
+	AKASSERT(gameObject);
+
+	const AkGeometrySetID geometrySetID = static_cast<AkGeometrySetID>(gameObject->get_instance_id());
+
+	AkAutoLock<CAkLock> scopedLock(geometryLock);
+
+	auto geometry = geometryCache.find(geometrySetID);
+
+	if (geometry == geometryCache.end())
 	{
-		AkMarkerCallbackInfo* markerInfo = static_cast<AkMarkerCallbackInfo*>(callbackInfo);
-		signalData["uIdentifier"] = static_cast<unsigned int>(markerInfo->uIdentifier);
-		signalData["uPosition"] = static_cast<unsigned int>(markerInfo->uPosition);
-		signalData["strLabel"] = String(markerInfo->strLabel);
-		break;
+		Godot::print_error("No geometry registered for game object " + String::num_int64(gameObject->get_instance_id()),
+						   __FUNCTION__, __FILE__, __LINE__);
+		return false;
 	}
-	case AK_Duration:
+
+	// Uploaded by the next RenderAudio, later transforms in the same frame replace this one
+	geometry->second.transform = transform;
+
+	if (!geometry->second.transformPending)
 	{
-		AkDurationCallbackInfo* durationInfo = static_cast<AkDurationCallbackInfo*>(callbackInfo);
-		signalData["audioNodeID"] = static_cast<unsigned int>(durationInfo->audioNodeID);
-		signalData["bStreaming"] = durationInfo->bStreaming;
-		signalData["eventID"] = static_cast<unsigned int>(durationInfo->eventID);
-		signalData["fDuration"] = static_cast<float>(durationInfo->fDuration);
-		signalData["fEstimatedDuration"] = static_cast<float>(durationInfo->fEstimatedDuration);
-		signalData["gameObjID"] = static_cast<unsigned int>(durationInfo->gameObjID);
-		signalData["mediaID"] = static_cast<unsigned int>(durationInfo->mediaID);
-		signalData["playingID"] = static_cast<unsigned int>(durationInfo->playingID);
-		break;
+		geometry->second.transformPending = true;
+		pendingGeometryTransforms.push_back(geometrySetID);
 	}
-	case AK_SpeakerVolumeMatrix:
+
+	return true;
+}
+
+bool Wwise::setGeometrySimplification(const Object* gameObject, const int targetTriangles, const float maxError)
+{
+	if (serverMode)
 	{
-		AkSpeakerVolumeMatrixCallbackInfo* speakerVolumeMatrixInfo =
-			static_cast<AkSpeakerVolumeMatrixCallbackInfo*>(callbackInfo);
-		signalData["eventID"] = static_cast<unsigned int>(speakerVolumeMatrixInfo->eventID);
-		signalData["gameObjID"] = static_cast<unsigned int>(speakerVolumeMatrixInfo->gameObjID);
+		return true;
+	}
 
-		Dictionary inputConfig;
-		inputConfig["uNumChannels"] = static_cast<unsigned int>(speakerVolumeMatrixInfo->inputConfig.uNumChannels);
-		inputConfig["eConfigType"] = static_cast<unsigned int>(speakerVolumeMatrixInfo->inputConfig.eConfigType);
-		inputConfig["uChannelMask"] = static_cast<unsigned int>(speakerVolumeMatrixInfo->inputConfig.uChannelMask);
-		signalData["inputConfig"] = inputConfig;
+	WWISE_PROFILE_SCOPE("set_geometry_simplification");
+	WWISE_RECORD_CALL("set_geometry_simplification", gameObject, targetTriangles, maxError);
 
-		Dictionary outputConfig;
-		outputConfig["uNumChannels"] = static_cast<unsigned int>(speakerVolumeMatrixInfo->outputConfig.uNumChannels);
-		outputConfig["eConfigType"] = static_cast<unsigned int>(speakerVolumeMatrixInfo->outputConfig.eConfigType);
-		outputConfig["uChannelMask"] = static_cast<unsigned int>(speakerVolumeMatrixInfo->outputConfig.uChannelMask);
-		signalData["outputConfig"] = outputConfig;
+	AKASSERT(gameObject);
 
-		signalData["playingID"] = static_cast<unsigned int>(speakerVolumeMatrixInfo->playingID);
-		break;
-	}
-	case AK_Starvation:
+	const AkGeometrySetID geometrySetID = static_cast<AkGeometrySetID>(gameObject->get_instance_id());
+
+	AkAutoLock<CAkLock> scopedLock(geometryLock);
+
+	if (targetTriangles <= 0 && maxError <= 0.0f)
 	{
-		AkEventCallbackInfo* eventInfo = static_cast<AkEventCallbackInfo*>(callbackInfo);
-		signalData["eventID"] = static_cast<unsigned int>(eventInfo->eventID);
-		signalData["gameObjID"] = static_cast<unsigned int>(eventInfo->gameObjID);
-		signalData["playingID"] = static_cast<unsigned int>(eventInfo->playingID);
-		break;
+		geometrySimplifications.erase(geometrySetID);
+		return true;
 	}
-	case AK_MusicPlaylistSelect:
+
+	// Takes effect the next time the geometry is set
+	WwiseGeometrySimplification& simplification = geometrySimplifications[geometrySetID];
+	simplification.targetTriangles = targetTriangles;
+	simplification.maxError = maxError;
+
+	return true;
+}
+
+Dictionary Wwise::getGeometryStats(const Object* gameObject)
+{
+	AKASSERT(gameObject);
+
+	Dictionary stats;
+
+	const AkGeometrySetID geometrySetID = static_cast<AkGeometrySetID>(gameObject->get_instance_id());
+
+	AkAutoLock<CAkLock> scopedLock(geometryLock);
+
+	auto geometry = geometryCache.find(geometrySetID);
+
+	if (geometry == geometryCache.end())
 	{
-		AkMusicPlaylistCallbackInfo* musicPlaylistInfo = static_cast<AkMusicPlaylistCallbackInfo*>(callbackInfo);
-		signalData["eventID"] = static_cast<unsigned int>(musicPlaylistInfo->eventID);
-		signalData["gameObjID"] = static_cast<unsigned int>(musicPlaylistInfo->gameObjID);
-		signalData["playingID"] = static_cast<unsigned int>(musicPlaylistInfo->playingID);
-		signalData["playlistID"] = static_cast<unsigned int>(musicPlaylistInfo->playlistID);
-		signalData["uNumPlaylistItems"] = static_cast<unsigned int>(musicPlaylistInfo->uNumPlaylistItems);
-		signalData["uPlaylistItemDone"] = static_cast<unsigned int>(musicPlaylistInfo->uPlaylistItemDone);
-		signalData["uPlaylistSelection"] = static_cast<unsigned int>(musicPlaylistInfo->uPlaylistSelection);
-		break;
+		return stats;
 	}
-	case AK_MusicPlayStarted:
+
+	const WwiseGeometryData& data = geometry->second.data;
+	stats["source_triangles"] = data.sourceTriangles;
+	stats["triangles"] = static_cast<int>(data.triangles.size());
+	stats["vertices"] = static_cast<int>(data.vertices.size());
+	stats["simplified_triangles"] = data.simplifiedTriangles;
+	stats["welded_vertices"] = data.weldedVertices;
+	stats["degenerate_triangles"] = data.degenerateTriangles;
+	stats["invalid_triangles"] = data.invalidTriangles;
+	stats["surfaces"] = data.surfaceCount;
+
+	return stats;
+}
+
+bool Wwise::removeGeometry(const Object* gameObject)
+{
+	if (serverMode)
 	{
-		AkEventCallbackInfo* eventInfo = static_cast<AkEventCallbackInfo*>(callbackInfo);
-		signalData["eventID"] = static_cast<unsigned int>(eventInfo->eventID);
-		signalData["gameObjID"] = static_cast<unsigned int>(eventInfo->gameObjID);
-		signalData["playingID"] = static_cast<unsigned int>(eventInfo->playingID);
-		break;
+		return true;
 	}
-	case AK_MusicSyncBeat:
-	{
-		AkMusicSyncCallbackInfo* musicSyncInfo = static_cast<AkMusicSyncCallbackInfo*>(callbackInfo);
-		signalData["gameObjID"] = static_cast<unsigned int>(musicSyncInfo->gameObjID);
-		signalData["musicSyncType"] = static_cast<unsigned int>(musicSyncInfo->musicSyncType);
-		signalData["playingID"] = static_cast<unsigned int>(musicSyncInfo->playingID);
-		signalData["pszUserCueName"] = String(musicSyncInfo->pszUserCueName);
 
-		Dictionary segmentInfo;
-		segmentInfo["fBarDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fBarDuration);
-		segmentInfo["fBeatDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fBeatDuration);
-		segmentInfo["fGridDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fGridDuration);
-		segmentInfo["fGridOffset"] = static_cast<float>(musicSyncInfo->segmentInfo.fGridOffset);
-		segmentInfo["iActiveDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iActiveDuration);
-		segmentInfo["iCurrentPosition"] = static_cast<int>(musicSyncInfo->segmentInfo.iCurrentPosition);
-		segmentInfo["iPostExitDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iPostExitDuration);
-		segmentInfo["iPreEntryDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iPreEntryDuration);
-		segmentInfo["iRemainingLookAheadTime"] = static_cast<int>(musicSyncInfo->segmentInfo.iRemainingLookAheadTime);
-		signalData["segmentInfo"] = segmentInfo;
-		break;
-	}
-	case AK_MusicSyncBar:
-	{
-		AkMusicSyncCallbackInfo* musicSyncInfo = static_cast<AkMusicSyncCallbackInfo*>(callbackInfo);
-		signalData["gameObjID"] = static_cast<unsigned int>(musicSyncInfo->gameObjID);
-		signalData["musicSyncType"] = static_cast<unsigned int>(musicSyncInfo->musicSyncType);
-		signalData["playingID"] = static_cast<unsigned int>(musicSyncInfo->playingID);
-		signalData["pszUserCueName"] = String(musicSyncInfo->pszUserCueName);
+	WWISE_COMMAND_SCOPE("remove_geometry");
+	WWISE_RECORD_CALL("remove_geometry", gameObject);
 
-		Dictionary segmentInfo;
-		segmentInfo["fBarDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fBarDuration);
-		segmentInfo["fBeatDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fBeatDuration);
-		segmentInfo["fGridDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fGridDuration);
-		segmentInfo["fGridOffset"] = static_cast<float>(musicSyncInfo->segmentInfo.fGridOffset);
-		segmentInfo["iActiveDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iActiveDuration);
-		segmentInfo["iCurrentPosition"] = static_cast<int>(musicSyncInfo->segmentInfo.iCurrentPosition);
-		segmentInfo["iPostExitDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iPostExitDuration);
-		segmentInfo["iPreEntryDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iPreEntryDuration);
-		segmentInfo["iRemainingLookAheadTime"] = static_cast<int>(musicSyncInfo->segmentInfo.iRemainingLookAheadTime);
-		signalData["segmentInfo"] = segmentInfo;
-		break;
+	AKASSERT(gameObject);
+
+	const AkGeometrySetID geometrySetID = static_cast<AkGeometrySetID>(gameObject->get_instance_id());
+
+	{
+		AkAutoLock<CAkLock> scopedLock(geometryLock);
+		geometryCache.erase(geometrySetID);
+		geometrySimplifications.erase(geometrySetID);
 	}
-	case AK_MusicSyncEntry:
+
+	cancelGeometryJob(geometrySetID);
+
+	return ERROR_CHECK(AK::SpatialAudio::RemoveGeometry(geometrySetID), "Failed to remove geometry");
+}
+
+bool Wwise::registerSpatialListener(const Object* gameObject)
+{
+	if (serverMode)
 	{
-		AkMusicSyncCallbackInfo* musicSyncInfo = static_cast<AkMusicSyncCallbackInfo*>(callbackInfo);
-		signalData["gameObjID"] = static_cast<unsigned int>(musicSyncInfo->gameObjID);
-		signalData["musicSyncType"] = static_cast<unsigned int>(musicSyncInfo->musicSyncType);
-		signalData["playingID"] = static_cast<unsigned int>(musicSyncInfo->playingID);
-		signalData["pszUserCueName"] = String(musicSyncInfo->pszUserCueName);
+		return true;
+	}
 
-		Dictionary segmentInfo;
-		segmentInfo["fBarDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fBarDuration);
-		segmentInfo["fBeatDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fBeatDuration);
-		segmentInfo["fGridDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fGridDuration);
-		segmentInfo["fGridOffset"] = static_cast<float>(musicSyncInfo->segmentInfo.fGridOffset);
-		segmentInfo["iActiveDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iActiveDuration);
-		segmentInfo["iCurrentPosition"] = static_cast<int>(musicSyncInfo->segmentInfo.iCurrentPosition);
-		segmentInfo["iPostExitDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iPostExitDuration);
-		segmentInfo["iPreEntryDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iPreEntryDuration);
-		segmentInfo["iRemainingLookAheadTime"] = static_cast<int>(musicSyncInfo->segmentInfo.iRemainingLookAheadTime);
-		signalData["segmentInfo"] = segmentInfo;
-		break;
+	WWISE_COMMAND_SCOPE("register_spatial_listener");
+	WWISE_RECORD_CALL("register_spatial_listener", gameObject);
+
+	AKASSERT(gameObject);
+
+	return ERROR_CHECK(AK::SpatialAudio::RegisterListener(static_cast<AkGameObjectID>(gameObject->get_instance_id())),
+					   "Failed to register Spatial Audio Listener");
+}
+
+bool Wwise::setRoom(const Object* gameObject, const unsigned int akAuxBusID, const String gameObjectName)
+{
+	if (serverMode)
+	{
+		return true;
 	}
-	case AK_MusicSyncExit:
+
+	WWISE_COMMAND_SCOPE("set_room");
+	WWISE_RECORD_CALL("set_room", gameObject, akAuxBusID, gameObjectName);
+
+	AKASSERT(gameObject);
+
+	AkRoomParams roomParams;
+	roomParams.ReverbAuxBus = akAuxBusID;
+	roomParams.strName = gameObjectName.alloc_c_string();
+	return ERROR_CHECK(AK::SpatialAudio::SetRoom(static_cast<AkRoomID>(gameObject->get_instance_id()), roomParams),
+					   "Failed to set Room for Game Object: " + String::num_int64(gameObject->get_instance_id()));
+}
+
+bool Wwise::removeRoom(const Object* gameObject)
+{
+	if (serverMode)
 	{
-		AkMusicSyncCallbackInfo* musicSyncInfo = static_cast<AkMusicSyncCallbackInfo*>(callbackInfo);
-		signalData["gameObjID"] = static_cast<unsigned int>(musicSyncInfo->gameObjID);
-		signalData["musicSyncType"] = static_cast<unsigned int>(musicSyncInfo->musicSyncType);
-		signalData["playingID"] = static_cast<unsigned int>(musicSyncInfo->playingID);
-		signalData["pszUserCueName"] = String(musicSyncInfo->pszUserCueName);
+		return true;
+	}
 
-		Dictionary segmentInfo;
-		segmentInfo["fBarDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fBarDuration);
-		segmentInfo["fBeatDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fBeatDuration);
-		segmentInfo["fGridDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fGridDuration);
-		segmentInfo["fGridOffset"] = static_cast<float>(musicSyncInfo->segmentInfo.fGridOffset);
-		segmentInfo["iActiveDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iActiveDuration);
-		segmentInfo["iCurrentPosition"] = static_cast<int>(musicSyncInfo->segmentInfo.iCurrentPosition);
-		segmentInfo["iPostExitDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iPostExitDuration);
-		segmentInfo["iPreEntryDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iPreEntryDuration);
-		segmentInfo["iRemainingLookAheadTime"] = static_cast<int>(musicSyncInfo->segmentInfo.iRemainingLookAheadTime);
-		signalData["segmentInfo"] = segmentInfo;
-		break;
+	WWISE_COMMAND_SCOPE("remove_room");
+	WWISE_RECORD_CALL("remove_room", gameObject);
+
+	roomResolver.removeRoom(gameObject->get_instance_id());
+
+	return ERROR_CHECK(AK::SpatialAudio::RemoveRoom(static_cast<AkRoomID>(gameObject->get_instance_id())),
+					   "Failed to remove Room for Game Object: " + String::num_int64(gameObject->get_instance_id()));
+}
+
+bool Wwise::addRoomVolume(const Object* gameObject, const Transform transform, const Vector3 extents,
+						  const int priority)
+{
+	if (serverMode)
+	{
+		return true;
 	}
-	case AK_MusicSyncGrid:
+
+	WWISE_COMMAND_SCOPE("add_room_volume");
+	WWISE_RECORD_CALL("add_room_volume", gameObject, transform, extents, priority);
+
+	AKASSERT(gameObject);
+
+	if (extents.x <= 0.0f || extents.y <= 0.0f || extents.z <= 0.0f)
 	{
-		AkMusicSyncCallbackInfo* musicSyncInfo = static_cast<AkMusicSyncCallbackInfo*>(callbackInfo);
-		signalData["gameObjID"] = static_cast<unsigned int>(musicSyncInfo->gameObjID);
-		signalData["musicSyncType"] = static_cast<unsigned int>(musicSyncInfo->musicSyncType);
-		signalData["playingID"] = static_cast<unsigned int>(musicSyncInfo->playingID);
-		signalData["pszUserCueName"] = String(musicSyncInfo->pszUserCueName);
+		Godot::print_error("Room volume of " + String::num_int64(gameObject->get_instance_id()) +
+							   " needs positive extents",
+						   __FUNCTION__, __FILE__, __LINE__);
+		return false;
+	}
 
-		Dictionary segmentInfo;
-		segmentInfo["fBarDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fBarDuration);
-		segmentInfo["fBeatDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fBeatDuration);
-		segmentInfo["fGridDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fGridDuration);
-		segmentInfo["fGridOffset"] = static_cast<float>(musicSyncInfo->segmentInfo.fGridOffset);
-		segmentInfo["iActiveDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iActiveDuration);
-		segmentInfo["iCurrentPosition"] = static_cast<int>(musicSyncInfo->segmentInfo.iCurrentPosition);
-		segmentInfo["iPostExitDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iPostExitDuration);
-		segmentInfo["iPreEntryDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iPreEntryDuration);
-		segmentInfo["iRemainingLookAheadTime"] = static_cast<int>(musicSyncInfo->segmentInfo.iRemainingLookAheadTime);
-		signalData["segmentInfo"] = segmentInfo;
+	// Game objects are moved in and out of the room from their position, see resolveRooms
+	roomResolver.addVolume(gameObject->get_instance_id(), transform, extents, priority);
+
+	return true;
+}
+
+int64_t Wwise::getGameObjectRoom(const Object* gameObject)
+{
+	AKASSERT(gameObject);
+
+	return static_cast<int64_t>(roomResolver.getRoom(gameObject->get_instance_id()));
+}
+
+bool Wwise::setPortal(const Object* gameObject, const Transform transform, const Vector3 extent,
+					  const Object* frontRoom, const Object* backRoom, bool enabled, const String portalName)
+{
+	if (serverMode)
+	{
+		return true;
+	}
+
+	WWISE_COMMAND_SCOPE("set_portal");
+	WWISE_RECORD_CALL("set_portal", gameObject, transform, extent, frontRoom, backRoom, enabled, portalName);
+
+	AKASSERT(gameObject);
+
+	AkVector position;
+	GetAkVector(transform, position, VectorType::POSITION);
+	AkVector forward;
+	GetAkVector(transform, forward, VectorType::FORWARD);
+	AkVector up;
+	GetAkVector(transform, up, VectorType::UP);
+
+	AkTransform akTransform;
+	akTransform.Set(position, forward, up);
+
+	AkVector akExtent;
+	Vector3ToAkVector(extent, akExtent);
+
+	AkRoomID roomID;
+
+	AkPortalParams portalParams;
+	portalParams.Transform = akTransform;
+	portalParams.Extent = akExtent;
+	portalParams.FrontRoom =
+		frontRoom ? static_cast<AkRoomID>(frontRoom->get_instance_id()) : static_cast<AkRoomID>(INVALID_ROOM_ID);
+	portalParams.BackRoom =
+		backRoom ? static_cast<AkRoomID>(backRoom->get_instance_id()) : static_cast<AkRoomID>(INVALID_ROOM_ID);
+	portalParams.bEnabled = enabled;
+	portalParams.strName = portalName.alloc_c_string();
+
+	return ERROR_CHECK(
+		AK::SpatialAudio::SetPortal(static_cast<AkPortalID>(gameObject->get_instance_id()), portalParams),
+		"Failed to set Portal on GameObject: " + String::num_int64(gameObject->get_instance_id()));
+}
+
+bool Wwise::removePortal(const Object* gameObject)
+{
+	if (serverMode)
+	{
+		return true;
+	}
+
+	WWISE_COMMAND_SCOPE("remove_portal");
+	WWISE_RECORD_CALL("remove_portal", gameObject);
+
+	AKASSERT(gameObject);
+	return ERROR_CHECK(AK::SpatialAudio::RemovePortal(static_cast<AkPortalID>(gameObject->get_instance_id())),
+					   "Failed to remove Portal for Game Object: " + String::num_int64(gameObject->get_instance_id()));
+}
+
+bool Wwise::setGameObjectInRoom(const Object* gameObject, const Object* room)
+{
+	if (serverMode)
+	{
+		return true;
+	}
+
+	WWISE_COMMAND_SCOPE("set_game_obj_in_room");
+	WWISE_RECORD_CALL("set_game_obj_in_room", gameObject, room);
+
+	AKASSERT(gameObject);
+	AKASSERT(room);
+	return ERROR_CHECK(AK::SpatialAudio::SetGameObjectInRoom(static_cast<AkGameObjectID>(gameObject->get_instance_id()),
+															 static_cast<AkRoomID>(room->get_instance_id())),
+					   "Failed to set Game Object in Room: " + String::num_int64(room->get_instance_id()));
+}
+
+bool Wwise::removeGameObjectFromRoom(const Object* gameObject)
+{
+	if (serverMode)
+	{
+		return true;
+	}
+
+	WWISE_COMMAND_SCOPE("remove_game_obj_from_room");
+	WWISE_RECORD_CALL("remove_game_obj_from_room", gameObject);
+
+	AKASSERT(gameObject);
+
+	return ERROR_CHECK(AK::SpatialAudio::SetGameObjectInRoom(static_cast<AkGameObjectID>(gameObject->get_instance_id()),
+															 INVALID_ROOM_ID),
+					   "Failed to remove Game Object from Room: " + String::num_int64(gameObject->get_instance_id()));
+}
+
+bool Wwise::setEarlyReflectionsAuxSend(const Object* gameObject, const unsigned int auxBusID)
+{
+	if (serverMode)
+	{
+		return true;
+	}
+
+	WWISE_COMMAND_SCOPE("set_early_reflections_aux_send");
+	WWISE_RECORD_CALL("set_early_reflections_aux_send", gameObject, auxBusID);
+
+	AKASSERT(gameObject);
+
+	return ERROR_CHECK(
+		AK::SpatialAudio::SetEarlyReflectionsAuxSend(static_cast<AkGameObjectID>(gameObject->get_instance_id()),
+													 static_cast<AkAuxBusID>(auxBusID)),
+		"Failed to set Early Reflections Aux Send");
+}
+
+bool Wwise::setEarlyReflectionsVolume(const Object* gameObject, const float volume)
+{
+	if (serverMode)
+	{
+		return true;
+	}
+
+	WWISE_COMMAND_SCOPE("set_early_reflections_volume");
+	WWISE_RECORD_CALL("set_early_reflections_volume", gameObject, volume);
+
+	AKASSERT(gameObject);
+
+	return ERROR_CHECK(
+		AK::SpatialAudio::SetEarlyReflectionsVolume(static_cast<AkGameObjectID>(gameObject->get_instance_id()), volume),
+		"Failed to set Early Reflections volume");
+}
+
+bool Wwise::addOutput(const String shareSet, const unsigned int outputID)
+{
+	if (serverMode)
+	{
+		return true;
+	}
+
+	WWISE_PROFILE_SCOPE("add_output");
+	WWISE_RECORD_CALL("add_output", shareSet, outputID);
+
+	AkOutputSettings outputSettings(shareSet.alloc_c_string(), outputID);
+
+	return ERROR_CHECK(AK::SoundEngine::AddOutput(outputSettings),
+					   "Failed to add share set to output ID: " + String::num_int64(outputID));
+}
+
+bool Wwise::removeOutput(const unsigned int outputID)
+{
+	if (serverMode)
+	{
+		return true;
+	}
+
+	WWISE_PROFILE_SCOPE("remove_output");
+	WWISE_RECORD_CALL("remove_output", outputID);
+
+	return ERROR_CHECK(AK::SoundEngine::RemoveOutput(outputID),
+					   "Failed to remove output ID: " + String::num_int64(outputID));
+}
+
+bool Wwise::suspend(bool renderAnyway)
+{
+	if (serverMode)
+	{
+		return true;
+	}
+
+	WWISE_PROFILE_SCOPE("suspend");
+	WWISE_RECORD_CALL("suspend", renderAnyway);
+
+	return ERROR_CHECK(AK::SoundEngine::Suspend(renderAnyway), "Failed to suspend SoundEngine");
+}
+
+bool Wwise::wakeupFromSuspend()
+{
+	if (serverMode)
+	{
+		return true;
+	}
+
+	WWISE_PROFILE_SCOPE("wakeup_from_suspend");
+	WWISE_RECORD_CALL("wakeup_from_suspend");
+
+	return ERROR_CHECK(AK::SoundEngine::WakeupFromSuspend(), "Failed to wake up SoundEngine from suspend");
+}
+
+void Wwise::transientEventCallback(AkCallbackType callbackType, AkCallbackInfo* callbackInfo)
+{
+	if (callbackType != AK_EndOfEvent)
+	{
+		return;
+	}
+
+	Wwise* wwise = static_cast<Wwise*>(callbackInfo->pCookie);
+
+	AkAutoLock<CAkLock> scopedLock(wwise->transientGameObjectLock);
+	wwise->freeTransientGameObjects.push_back(callbackInfo->gameObjID);
+}
+
+bool Wwise::registerTransientGameObject(AkGameObjectID& out_gameObjectID)
+{
+	const AkGameObjectID gameObjectID = TRANSIENT_GAME_OBJECT_ID_BASE + transientGameObjectCount;
+
+	if (!ERROR_CHECK(AK::SoundEngine::RegisterGameObj(gameObjectID, "Transient Game Object"),
+					 "Failed to register transient game object"))
+	{
+		return false;
+	}
+
+	++transientGameObjectCount;
+	out_gameObjectID = gameObjectID;
+
+	return true;
+}
+
+AkGameObjectID Wwise::acquireTransientGameObject()
+{
+	{
+		AkAutoLock<CAkLock> scopedLock(transientGameObjectLock);
+
+		if (!freeTransientGameObjects.empty())
+		{
+			const AkGameObjectID gameObjectID = freeTransientGameObjects.back();
+			freeTransientGameObjects.pop_back();
+
+			return gameObjectID;
+		}
+	}
+
+	// Every game object of the pool is playing, the pool grows by one instead of dropping the one-shot until it
+	// reaches its max size
+	AkGameObjectID gameObjectID = AK_INVALID_GAME_OBJECT;
+
+	if (transientGameObjectCount < maxTransientGameObjects)
+	{
+		registerTransientGameObject(gameObjectID);
+	}
+
+	return gameObjectID;
+}
+
+void Wwise::eventCallback(AkCallbackType callbackType, AkCallbackInfo* callbackInfo)
+{
+	AkAutoLock<CAkLock> ScopedLock(signalDataLock);
+
+	Dictionary signalData;
+	signalData["callbackType"] = static_cast<unsigned int>(callbackType);
+
+	switch (callbackType)
+	{
+	case AK_EndOfEvent:
+	{
+		AkEventCallbackInfo* eventInfo = static_cast<AkEventCallbackInfo*>(callbackInfo);
+		signalData["eventID"] = static_cast<unsigned int>(eventInfo->eventID);
+		signalData["gameObjID"] = static_cast<unsigned int>(eventInfo->gameObjID);
+		signalData["playingID"] = static_cast<unsigned int>(eventInfo->playingID);
+		break;
+	}
+	case AK_EndOfDynamicSequenceItem:
+	{
+		AkDynamicSequenceItemCallbackInfo* dynamicSequenceItemInfo =
+			static_cast<AkDynamicSequenceItemCallbackInfo*>(callbackInfo);
+		signalData["audioNodeID"] = static_cast<unsigned int>(dynamicSequenceItemInfo->audioNodeID);
+		signalData["gameObjID"] = static_cast<unsigned int>(dynamicSequenceItemInfo->gameObjID);
+		signalData["playingID"] = static_cast<unsigned int>(dynamicSequenceItemInfo->playingID);
+		break;
+	}
+	case AK_Marker:
+	{
+		AkMarkerCallbackInfo* markerInfo = static_cast<AkMarkerCallbackInfo*>(callbackInfo);
+		signalData["uIdentifier"] = static_cast<unsigned int>(markerInfo->uIdentifier);
+		signalData["uPosition"] = static_cast<unsigned int>(markerInfo->uPosition);
+		signalData["strLabel"] = String(markerInfo->strLabel);
+		break;
+	}
+	case AK_Duration:
+	{
+		AkDurationCallbackInfo* durationInfo = static_cast<AkDurationCallbackInfo*>(callbackInfo);
+		signalData["audioNodeID"] = static_cast<unsigned int>(durationInfo->audioNodeID);
+		signalData["bStreaming"] = durationInfo->bStreaming;
+		signalData["eventID"] = static_cast<unsigned int>(durationInfo->eventID);
+		signalData["fDuration"] = static_cast<float>(durationInfo->fDuration);
+		signalData["fEstimatedDuration"] = static_cast<float>(durationInfo->fEstimatedDuration);
+		signalData["gameObjID"] = static_cast<unsigned int>(durationInfo->gameObjID);
+		signalData["mediaID"] = static_cast<unsigned int>(durationInfo->mediaID);
+		signalData["playingID"] = static_cast<unsigned int>(durationInfo->playingID);
 		break;
 	}
-	case AK_MusicSyncUserCue:
+	case AK_SpeakerVolumeMatrix:
+	{
+		AkSpeakerVolumeMatrixCallbackInfo* speakerVolumeMatrixInfo =
+			static_cast<AkSpeakerVolumeMatrixCallbackInfo*>(callbackInfo);
+		signalData["eventID"] = static_cast<unsigned int>(speakerVolumeMatrixInfo->eventID);
+		signalData["gameObjID"] = static_cast<unsigned int>(speakerVolumeMatrixInfo->gameObjID);
+
+		Dictionary inputConfig;
+		inputConfig["uNumChannels"] = static_cast<unsigned int>(speakerVolumeMatrixInfo->inputConfig.uNumChannels);
+		inputConfig["eConfigType"] = static_cast<unsigned int>(speakerVolumeMatrixInfo->inputConfig.eConfigType);
+		inputConfig["uChannelMask"] = static_cast<unsigned int>(speakerVolumeMatrixInfo->inputConfig.uChannelMask);
+		signalData["inputConfig"] = inputConfig;
+
+		Dictionary outputConfig;
+		outputConfig["uNumChannels"] = static_cast<unsigned int>(speakerVolumeMatrixInfo->outputConfig.uNumChannels);
+		outputConfig["eConfigType"] = static_cast<unsigned int>(speakerVolumeMatrixInfo->outputConfig.eConfigType);
+		outputConfig["uChannelMask"] = static_cast<unsigned int>(speakerVolumeMatrixInfo->outputConfig.uChannelMask);
+		signalData["outputConfig"] = outputConfig;
+
+		signalData["playingID"] = static_cast<unsigned int>(speakerVolumeMatrixInfo->playingID);
+		break;
+	}
+	case AK_Starvation:
+	{
+		AkEventCallbackInfo* eventInfo = static_cast<AkEventCallbackInfo*>(callbackInfo);
+		signalData["eventID"] = static_cast<unsigned int>(eventInfo->eventID);
+		signalData["gameObjID"] = static_cast<unsigned int>(eventInfo->gameObjID);
+		signalData["playingID"] = static_cast<unsigned int>(eventInfo->playingID);
+		break;
+	}
+	case AK_MusicPlaylistSelect:
+	{
+		AkMusicPlaylistCallbackInfo* musicPlaylistInfo = static_cast<AkMusicPlaylistCallbackInfo*>(callbackInfo);
+		signalData["eventID"] = static_cast<unsigned int>(musicPlaylistInfo->eventID);
+		signalData["gameObjID"] = static_cast<unsigned int>(musicPlaylistInfo->gameObjID);
+		signalData["playingID"] = static_cast<unsigned int>(musicPlaylistInfo->playingID);
+		signalData["playlistID"] = static_cast<unsigned int>(musicPlaylistInfo->playlistID);
+		signalData["uNumPlaylistItems"] = static_cast<unsigned int>(musicPlaylistInfo->uNumPlaylistItems);
+		signalData["uPlaylistItemDone"] = static_cast<unsigned int>(musicPlaylistInfo->uPlaylistItemDone);
+		signalData["uPlaylistSelection"] = static_cast<unsigned int>(musicPlaylistInfo->uPlaylistSelection);
+		break;
+	}
+	case AK_MusicPlayStarted:
+	{
+		AkEventCallbackInfo* eventInfo = static_cast<AkEventCallbackInfo*>(callbackInfo);
+		signalData["eventID"] = static_cast<unsigned int>(eventInfo->eventID);
+		signalData["gameObjID"] = static_cast<unsigned int>(eventInfo->gameObjID);
+		signalData["playingID"] = static_cast<unsigned int>(eventInfo->playingID);
+		break;
+	}
+	case AK_MusicSyncBeat:
+	{
+		AkMusicSyncCallbackInfo* musicSyncInfo = static_cast<AkMusicSyncCallbackInfo*>(callbackInfo);
+		signalData["gameObjID"] = static_cast<unsigned int>(musicSyncInfo->gameObjID);
+		signalData["musicSyncType"] = static_cast<unsigned int>(musicSyncInfo->musicSyncType);
+		signalData["playingID"] = static_cast<unsigned int>(musicSyncInfo->playingID);
+		signalData["pszUserCueName"] = String(musicSyncInfo->pszUserCueName);
+
+		Dictionary segmentInfo;
+		segmentInfo["fBarDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fBarDuration);
+		segmentInfo["fBeatDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fBeatDuration);
+		segmentInfo["fGridDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fGridDuration);
+		segmentInfo["fGridOffset"] = static_cast<float>(musicSyncInfo->segmentInfo.fGridOffset);
+		segmentInfo["iActiveDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iActiveDuration);
+		segmentInfo["iCurrentPosition"] = static_cast<int>(musicSyncInfo->segmentInfo.iCurrentPosition);
+		segmentInfo["iPostExitDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iPostExitDuration);
+		segmentInfo["iPreEntryDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iPreEntryDuration);
+		segmentInfo["iRemainingLookAheadTime"] = static_cast<int>(musicSyncInfo->segmentInfo.iRemainingLookAheadTime);
+		signalData["segmentInfo"] = segmentInfo;
+		break;
+	}
+	case AK_MusicSyncBar:
+	{
+		AkMusicSyncCallbackInfo* musicSyncInfo = static_cast<AkMusicSyncCallbackInfo*>(callbackInfo);
+		signalData["gameObjID"] = static_cast<unsigned int>(musicSyncInfo->gameObjID);
+		signalData["musicSyncType"] = static_cast<unsigned int>(musicSyncInfo->musicSyncType);
+		signalData["playingID"] = static_cast<unsigned int>(musicSyncInfo->playingID);
+		signalData["pszUserCueName"] = String(musicSyncInfo->pszUserCueName);
+
+		Dictionary segmentInfo;
+		segmentInfo["fBarDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fBarDuration);
+		segmentInfo["fBeatDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fBeatDuration);
+		segmentInfo["fGridDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fGridDuration);
+		segmentInfo["fGridOffset"] = static_cast<float>(musicSyncInfo->segmentInfo.fGridOffset);
+		segmentInfo["iActiveDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iActiveDuration);
+		segmentInfo["iCurrentPosition"] = static_cast<int>(musicSyncInfo->segmentInfo.iCurrentPosition);
+		segmentInfo["iPostExitDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iPostExitDuration);
+		segmentInfo["iPreEntryDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iPreEntryDuration);
+		segmentInfo["iRemainingLookAheadTime"] = static_cast<int>(musicSyncInfo->segmentInfo.iRemainingLookAheadTime);
+		signalData["segmentInfo"] = segmentInfo;
+		break;
+	}
+	case AK_MusicSyncEntry:
+	{
+		AkMusicSyncCallbackInfo* musicSyncInfo = static_cast<AkMusicSyncCallbackInfo*>(callbackInfo);
+		signalData["gameObjID"] = static_cast<unsigned int>(musicSyncInfo->gameObjID);
+		signalData["musicSyncType"] = static_cast<unsigned int>(musicSyncInfo->musicSyncType);
+		signalData["playingID"] = static_cast<unsigned int>(musicSyncInfo->playingID);
+		signalData["pszUserCueName"] = String(musicSyncInfo->pszUserCueName);
+
+		Dictionary segmentInfo;
+		segmentInfo["fBarDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fBarDuration);
+		segmentInfo["fBeatDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fBeatDuration);
+		segmentInfo["fGridDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fGridDuration);
+		segmentInfo["fGridOffset"] = static_cast<float>(musicSyncInfo->segmentInfo.fGridOffset);
+		segmentInfo["iActiveDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iActiveDuration);
+		segmentInfo["iCurrentPosition"] = static_cast<int>(musicSyncInfo->segmentInfo.iCurrentPosition);
+		segmentInfo["iPostExitDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iPostExitDuration);
+		segmentInfo["iPreEntryDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iPreEntryDuration);
+		segmentInfo["iRemainingLookAheadTime"] = static_cast<int>(musicSyncInfo->segmentInfo.iRemainingLookAheadTime);
+		signalData["segmentInfo"] = segmentInfo;
+		break;
+	}
+	case AK_MusicSyncExit:
+	{
+		AkMusicSyncCallbackInfo* musicSyncInfo = static_cast<AkMusicSyncCallbackInfo*>(callbackInfo);
+		signalData["gameObjID"] = static_cast<unsigned int>(musicSyncInfo->gameObjID);
+		signalData["musicSyncType"] = static_cast<unsigned int>(musicSyncInfo->musicSyncType);
+		signalData["playingID"] = static_cast<unsigned int>(musicSyncInfo->playingID);
+		signalData["pszUserCueName"] = String(musicSyncInfo->pszUserCueName);
+
+		Dictionary segmentInfo;
+		segmentInfo["fBarDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fBarDuration);
+		segmentInfo["fBeatDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fBeatDuration);
+		segmentInfo["fGridDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fGridDuration);
+		segmentInfo["fGridOffset"] = static_cast<float>(musicSyncInfo->segmentInfo.fGridOffset);
+		segmentInfo["iActiveDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iActiveDuration);
+		segmentInfo["iCurrentPosition"] = static_cast<int>(musicSyncInfo->segmentInfo.iCurrentPosition);
+		segmentInfo["iPostExitDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iPostExitDuration);
+		segmentInfo["iPreEntryDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iPreEntryDuration);
+		segmentInfo["iRemainingLookAheadTime"] = static_cast<int>(musicSyncInfo->segmentInfo.iRemainingLookAheadTime);
+		signalData["segmentInfo"] = segmentInfo;
+		break;
+	}
+	case AK_MusicSyncGrid:
+	{
+		AkMusicSyncCallbackInfo* musicSyncInfo = static_cast<AkMusicSyncCallbackInfo*>(callbackInfo);
+		signalData["gameObjID"] = static_cast<unsigned int>(musicSyncInfo->gameObjID);
+		signalData["musicSyncType"] = static_cast<unsigned int>(musicSyncInfo->musicSyncType);
+		signalData["playingID"] = static_cast<unsigned int>(musicSyncInfo->playingID);
+		signalData["pszUserCueName"] = String(musicSyncInfo->pszUserCueName);
+
+		Dictionary segmentInfo;
+		segmentInfo["fBarDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fBarDuration);
+		segmentInfo["fBeatDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fBeatDuration);
+		segmentInfo["fGridDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fGridDuration);
+		segmentInfo["fGridOffset"] = static_cast<float>(musicSyncInfo->segmentInfo.fGridOffset);
+		segmentInfo["iActiveDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iActiveDuration);
+		segmentInfo["iCurrentPosition"] = static_cast<int>(musicSyncInfo->segmentInfo.iCurrentPosition);
+		segmentInfo["iPostExitDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iPostExitDuration);
+		segmentInfo["iPreEntryDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iPreEntryDuration);
+		segmentInfo["iRemainingLookAheadTime"] = static_cast<int>(musicSyncInfo->segmentInfo.iRemainingLookAheadTime);
+		signalData["segmentInfo"] = segmentInfo;
+		break;
+	}
+	case AK_MusicSyncUserCue:
+	{
+		AkMusicSyncCallbackInfo* musicSyncInfo = static_cast<AkMusicSyncCallbackInfo*>(callbackInfo);
+		signalData["gameObjID"] = static_cast<unsigned int>(musicSyncInfo->gameObjID);
+		signalData["musicSyncType"] = static_cast<unsigned int>(musicSyncInfo->musicSyncType);
+		signalData["playingID"] = static_cast<unsigned int>(musicSyncInfo->playingID);
+		signalData["pszUserCueName"] = String(musicSyncInfo->pszUserCueName);
+
+		Dictionary segmentInfo;
+		segmentInfo["fBarDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fBarDuration);
+		segmentInfo["fBeatDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fBeatDuration);
+		segmentInfo["fGridDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fGridDuration);
+		segmentInfo["fGridOffset"] = static_cast<float>(musicSyncInfo->segmentInfo.fGridOffset);
+		segmentInfo["iActiveDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iActiveDuration);
+		segmentInfo["iCurrentPosition"] = static_cast<int>(musicSyncInfo->segmentInfo.iCurrentPosition);
+		segmentInfo["iPostExitDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iPostExitDuration);
+		segmentInfo["iPreEntryDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iPreEntryDuration);
+		segmentInfo["iRemainingLookAheadTime"] = static_cast<int>(musicSyncInfo->segmentInfo.iRemainingLookAheadTime);
+		signalData["segmentInfo"] = segmentInfo;
+		break;
+	}
+	case AK_MusicSyncPoint:
+	{
+		AkMusicSyncCallbackInfo* musicSyncInfo = static_cast<AkMusicSyncCallbackInfo*>(callbackInfo);
+		signalData["gameObjID"] = static_cast<unsigned int>(musicSyncInfo->gameObjID);
+		signalData["musicSyncType"] = static_cast<unsigned int>(musicSyncInfo->musicSyncType);
+		signalData["playingID"] = static_cast<unsigned int>(musicSyncInfo->playingID);
+		signalData["pszUserCueName"] = String(musicSyncInfo->pszUserCueName);
+
+		Dictionary segmentInfo;
+		segmentInfo["fBarDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fBarDuration);
+		segmentInfo["fBeatDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fBeatDuration);
+		segmentInfo["fGridDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fGridDuration);
+		segmentInfo["fGridOffset"] = static_cast<float>(musicSyncInfo->segmentInfo.fGridOffset);
+		segmentInfo["iActiveDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iActiveDuration);
+		segmentInfo["iCurrentPosition"] = static_cast<int>(musicSyncInfo->segmentInfo.iCurrentPosition);
+		segmentInfo["iPostExitDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iPostExitDuration);
+		segmentInfo["iPreEntryDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iPreEntryDuration);
+		segmentInfo["iRemainingLookAheadTime"] = static_cast<int>(musicSyncInfo->segmentInfo.iRemainingLookAheadTime);
+		signalData["segmentInfo"] = segmentInfo;
+		break;
+	}
+	case AK_MusicSyncAll:
+	{
+		AkMusicSyncCallbackInfo* musicSyncInfo = static_cast<AkMusicSyncCallbackInfo*>(callbackInfo);
+		signalData["gameObjID"] = static_cast<unsigned int>(musicSyncInfo->gameObjID);
+		signalData["musicSyncType"] = static_cast<unsigned int>(musicSyncInfo->musicSyncType);
+		signalData["playingID"] = static_cast<unsigned int>(musicSyncInfo->playingID);
+		signalData["pszUserCueName"] = String(musicSyncInfo->pszUserCueName);
+
+		Dictionary segmentInfo;
+		segmentInfo["fBarDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fBarDuration);
+		segmentInfo["fBeatDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fBeatDuration);
+		segmentInfo["fGridDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fGridDuration);
+		segmentInfo["fGridOffset"] = static_cast<float>(musicSyncInfo->segmentInfo.fGridOffset);
+		segmentInfo["iActiveDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iActiveDuration);
+		segmentInfo["iCurrentPosition"] = static_cast<int>(musicSyncInfo->segmentInfo.iCurrentPosition);
+		segmentInfo["iPostExitDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iPostExitDuration);
+		segmentInfo["iPreEntryDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iPreEntryDuration);
+		segmentInfo["iRemainingLookAheadTime"] = static_cast<int>(musicSyncInfo->segmentInfo.iRemainingLookAheadTime);
+		signalData["segmentInfo"] = segmentInfo;
+		break;
+	}
+	case AK_MIDIEvent:
+	{
+		AkMIDIEventCallbackInfo* midiEventInfo = static_cast<AkMIDIEventCallbackInfo*>(callbackInfo);
+		signalData["eventID"] = static_cast<unsigned int>(midiEventInfo->eventID);
+		signalData["gameObjID"] = static_cast<unsigned int>(midiEventInfo->gameObjID);
+
+		Dictionary midiEvent;
+		midiEvent["byType"] = static_cast<unsigned char>(midiEventInfo->midiEvent.byType);
+		midiEvent["byChan"] = static_cast<unsigned char>(midiEventInfo->midiEvent.byChan);
+
+		Dictionary cc;
+		cc["byCc"] = static_cast<unsigned char>(midiEventInfo->midiEvent.Cc.byCc);
+		cc["byValue"] = static_cast<unsigned char>(midiEventInfo->midiEvent.Cc.byValue);
+
+		Dictionary chanAftertouch;
+		chanAftertouch["byValue"] = static_cast<unsigned char>(midiEventInfo->midiEvent.ChanAftertouch.byValue);
+
+		Dictionary gen;
+		gen["byParam1"] = static_cast<unsigned char>(midiEventInfo->midiEvent.Gen.byParam1);
+		gen["byParam2"] = static_cast<unsigned char>(midiEventInfo->midiEvent.Gen.byParam2);
+
+		Dictionary noteAftertouch;
+		noteAftertouch["byNote"] = static_cast<unsigned char>(midiEventInfo->midiEvent.NoteAftertouch.byNote);
+		noteAftertouch["byValue"] = static_cast<unsigned char>(midiEventInfo->midiEvent.NoteAftertouch.byValue);
+
+		Dictionary noteOnOff;
+		noteOnOff["byNote"] = static_cast<unsigned char>(midiEventInfo->midiEvent.NoteOnOff.byNote);
+		noteOnOff["byVelocity"] = static_cast<unsigned char>(midiEventInfo->midiEvent.NoteOnOff.byVelocity);
+
+		Dictionary pitchBend;
+		pitchBend["byValueLsb"] = static_cast<unsigned char>(midiEventInfo->midiEvent.PitchBend.byValueLsb);
+		pitchBend["byValueMsb"] = static_cast<unsigned char>(midiEventInfo->midiEvent.PitchBend.byValueMsb);
+
+		Dictionary programChange;
+		programChange["byProgramNum"] = static_cast<unsigned char>(midiEventInfo->midiEvent.ProgramChange.byProgramNum);
+
+		midiEvent["cc"] = cc;
+		midiEvent["chanAftertouch"] = chanAftertouch;
+		midiEvent["gen"] = gen;
+		midiEvent["noteAftertouch"] = noteAftertouch;
+		midiEvent["noteOnOff"] = noteOnOff;
+		midiEvent["pitchBend"] = pitchBend;
+		midiEvent["programChange"] = programChange;
+
+		signalData["midiEvent"] = midiEvent;
+
+		signalData["playingID"] = static_cast<unsigned int>(midiEventInfo->playingID);
+		break;
+	}
+	case AK_CallbackBits:
+	case AK_EnableGetSourcePlayPosition:
+	case AK_EnableGetMusicPlayPosition:
+	case AK_EnableGetSourceStreamBuffering:
+		break;
+	default:
+		AKASSERT(false);
+		break;
+	}
+
+	if (signalDataArray->size() < signalCallbackDataMaxSize)
+	{
+		signalDataArray->append(signalData);
+	}
+	else
+	{
+		Godot::print_warning("Exceeded the signal callback data maximum size (callback manager)", __FUNCTION__,
+							 __FILE__, __LINE__);
+	}
+}
+
+void Wwise::emitSignals()
+{
+	AkAutoLock<CAkLock> ScopedLock(signalDataLock);
+
+	const int initialArraySize = signalDataArray->size();
+
+	for (int signalIndex = 0; signalIndex < initialArraySize; ++signalIndex)
+	{
+		const Dictionary data = signalDataArray->pop_front();
+		const unsigned int callbackType = static_cast<unsigned int>(data["callbackType"]);
+
+		emit_signal(WwiseCallbackToSignal(static_cast<AkCallbackType>(callbackType)), data);
+	}
+
+	AKASSERT(signalDataArray->size() == 0);
+}
+
+void Wwise::bankCallback(AkUInt32 bankID, const void* inMemoryBankPtr, AKRESULT loadResult, AkMemPoolId memPoolId)
+{
+	if (WwiseTraceRecorder::isRecording())
+	{
+		WwiseTraceRecorder::recordAsyncEnd("bank", bankID, static_cast<int64_t>(loadResult));
+	}
+
+	AkAutoLock<CAkLock> ScopedLock(signalDataLock);
+
+	Dictionary signalData;
+	signalData["bankID"] = static_cast<unsigned int>(bankID);
+	signalData["result"] = static_cast<unsigned int>(loadResult);
+
+	if (signalBankDataArray->size() < signalCallbackDataMaxSize)
+	{
+		signalBankDataArray->append(signalData);
+	}
+	else
+	{
+		Godot::print_warning("Exceeded the signal callback data maximum size (callback manager)", __FUNCTION__,
+							 __FILE__, __LINE__);
+	}
+}
+
+void Wwise::emitBankSignals()
+{
+	AkAutoLock<CAkLock> ScopedLock(signalDataLock);
+
+	const int initialArraySize = signalBankDataArray->size();
+
+	for (int signalIndex = 0; signalIndex < initialArraySize; ++signalIndex)
+	{
+		const Dictionary data = signalBankDataArray->pop_front();
+		emit_signal("bank_callback", data);
+	}
+
+	AKASSERT(signalBankDataArray->size() == 0);
+}
+
+Dictionary Wwise::getStartupTimings()
+{
+	Dictionary timings = startupTimings.duplicate();
+
+#ifndef AK_OPTIMIZED
+	// Comm initialisation runs on its own thread and may still be in flight
+	const int64_t commDurationUsec = commInitDurationUsec.load();
+
+	if (commDurationUsec >= 0)
+	{
+		timings["comm"] = static_cast<float>(commDurationUsec) / 1000.0f;
+	}
+#endif
+
+	return timings;
+}
+
+Dictionary Wwise::getMemoryStats()
+{
+	return CAkMemoryPoolGodot::GetStats();
+}
+
+Dictionary Wwise::getStats()
+{
+	Dictionary stats;
+
+	stats["memory"] = getMemoryStats();
+
+	stats["tick_mode"] = static_cast<int>(config.renderTickMode);
+	stats["offline_rendering"] = config.offlineRendering;
+	stats["server_mode"] = serverMode;
+
+	{
+		AkAutoLock<CAkLock> ScopedLock(statsLock);
+
+		stats["render_audio_last_ms"] = static_cast<float>(renderAudioTiming.lastUsec) / 1000.0f;
+		stats["render_audio_average_ms"] = static_cast<float>(renderAudioTiming.averageUsec / 1000.0);
+		stats["render_audio_peak_ms"] = static_cast<float>(renderAudioTiming.peakUsec) / 1000.0f;
+		stats["render_audio_calls"] = static_cast<int64_t>(renderAudioTiming.count);
+
+		// Time between the first command of an audio frame and the RenderAudio call that submits it
+		stats["command_latency_last_ms"] = static_cast<float>(commandLatencyTiming.lastUsec) / 1000.0f;
+		stats["command_latency_average_ms"] = static_cast<float>(commandLatencyTiming.averageUsec / 1000.0);
+		stats["command_latency_peak_ms"] = static_cast<float>(commandLatencyTiming.peakUsec) / 1000.0f;
+	}
+
+	unsigned int activeGameObjects = 0;
+	unsigned int activeEvents = 0;
+
+	if (AK::SoundEngine::IsInitialized())
+	{
+		AK::SoundEngine::Query::AkGameObjectsList gameObjectsList;
+
+		if (AK::SoundEngine::Query::GetActiveGameObjects(gameObjectsList) == AK_Success)
+		{
+			activeGameObjects = gameObjectsList.Length();
+
+			for (AkUInt32 i = 0; i < gameObjectsList.Length(); ++i)
+			{
+				// Passing a null array only queries the number of playing IDs
+				AkUInt32 numPlayingIDs = 0;
+				AK::SoundEngine::Query::GetPlayingIDsFromGameObject(gameObjectsList[i], numPlayingIDs, nullptr);
+				activeEvents += numPlayingIDs;
+			}
+		}
+
+		gameObjectsList.Term();
+	}
+
+	stats["active_game_objects"] = activeGameObjects;
+	stats["active_events"] = activeEvents;
+
+	return stats;
+}
+
+void Wwise::resetStats()
+{
+	AkAutoLock<CAkLock> ScopedLock(statsLock);
+
+	renderAudioTiming.reset();
+	commandLatencyTiming.reset();
+}
+
+void Wwise::setApiProfilingEnabled(const bool enabled)
+{
+#if !defined(AK_OPTIMIZED)
+	WwiseApiProfiler::setEnabled(enabled);
+#else
+	Godot::print_warning("API profiling is not available in optimized builds", __FUNCTION__, __FILE__, __LINE__);
+#endif
+}
+
+Array Wwise::getApiReport(const int count)
+{
+#if !defined(AK_OPTIMIZED)
+	return WwiseApiProfiler::getReport(count);
+#else
+	return Array();
+#endif
+}
+
+bool Wwise::startTrace(const int capacity)
+{
+	return WwiseTraceRecorder::start(capacity);
+}
+
+void Wwise::stopTrace()
+{
+	WwiseTraceRecorder::stop();
+}
+
+bool Wwise::flushTrace(const String path)
+{
+	const String tracePath = path.empty() ? String("user://wwise_trace.json") : path;
+
+	if (WwiseTraceRecorder::isRecording())
+	{
+		Godot::print_warning("Stop the trace before flushing it", __FUNCTION__, __FILE__, __LINE__);
+		return false;
+	}
+
+	if (!WwiseTraceRecorder::flush(tracePath))
+	{
+		Godot::print_error("Failed to write the trace to " + tracePath, __FUNCTION__, __FILE__, __LINE__);
+		return false;
+	}
+
+	return true;
+}
+
+void Wwise::beginCommandBatch()
+{
+	if (config.renderTickMode != RenderTickMode::FIXED_RATE_THREAD)
+	{
+		return;
+	}
+
+	// Waits for a RenderAudio in progress, the commands that follow go to the next audio frame together
+	AkAutoLock<CAkLock> ScopedLock(commandSubmissionLock);
+
+	if (!commandBatchOpen)
+	{
+		commandBatchOpen = true;
+		commandBatchStart = std::chrono::steady_clock::now();
+	}
+}
+
+void Wwise::endCommandBatch()
+{
+	AkAutoLock<CAkLock> ScopedLock(commandSubmissionLock);
+	commandBatchOpen = false;
+}
+
+Dictionary Wwise::renderFrames(const int count)
+{
+	WWISE_PROFILE_SCOPE("render_frames");
+
+	Dictionary result;
+
+	if (!config.offlineRendering)
+	{
+		Godot::print_warning("render_frames needs offline rendering to be enabled in the project settings",
+							 __FUNCTION__, __FILE__, __LINE__);
+		return result;
+	}
+
+	int64_t peakFrameUsec = 0;
+	const int64_t startUsec = GetTicksUsec();
+
+	for (int i = 0; i < count; ++i)
+	{
+		const int64_t frameStartUsec = GetTicksUsec();
+		renderAudio();
+		const int64_t frameUsec = GetTicksUsec() - frameStartUsec;
+
+		if (frameUsec > peakFrameUsec)
+		{
+			peakFrameUsec = frameUsec;
+		}
+	}
+
+	const int64_t totalUsec = GetTicksUsec() - startUsec;
+
+	result["frames"] = count;
+	result["audio_time_ms"] = static_cast<float>(count * offlineFrameTime * 1000.0);
+	result["total_ms"] = static_cast<float>(totalUsec) / 1000.0f;
+	result["average_frame_ms"] = count > 0 ? static_cast<float>(totalUsec) / 1000.0f / count : 0.0f;
+	result["peak_frame_ms"] = static_cast<float>(peakFrameUsec) / 1000.0f;
+
+	return result;
+}
+
+bool Wwise::startOutputCapture(const float seconds)
+{
+	if (!WwiseOutputCapture::start(seconds))
+	{
+		Godot::print_error("Failed to start the output capture", __FUNCTION__, __FILE__, __LINE__);
+		return false;
+	}
+
+	return true;
+}
+
+void Wwise::stopOutputCapture()
+{
+	WwiseOutputCapture::stop();
+}
+
+PoolRealArray Wwise::readCapturedFrames(const int maxFrames)
+{
+	return WwiseOutputCapture::readFrames(maxFrames);
+}
+
+PoolByteArray Wwise::readCapturedPCM16(const int maxFrames)
+{
+	return WwiseOutputCapture::readFramesPCM16(maxFrames);
+}
+
+Dictionary Wwise::getOutputCaptureInfo()
+{
+	return WwiseOutputCapture::getInfo();
+}
+
+bool Wwise::isServerMode()
+{
+	return serverMode;
+}
+
+Dictionary Wwise::getServerGameSyncs()
+{
+	Dictionary gameSyncs;
+
+	gameSyncs["states"] = serverStates.duplicate();
+	gameSyncs["switches"] = serverSwitches.duplicate(true);
+	gameSyncs["rtpcs"] = serverRTPCs.duplicate(true);
+
+	return gameSyncs;
+}
+
+void Wwise::startCallRecording()
+{
+	WwiseCallLog::start();
+}
+
+void Wwise::stopCallRecording()
+{
+	WwiseCallLog::stop();
+}
+
+bool Wwise::saveCallRecording(const String path)
+{
+	const String logPath = path.empty() ? String("user://wwise_calls.log") : path;
+
+	if (!WwiseCallLog::save(logPath))
+	{
+		Godot::print_error("Failed to write the call log to " + logPath, __FUNCTION__, __FILE__, __LINE__);
+		return false;
+	}
+
+	return true;
+}
+
+Dictionary Wwise::replayCallLog(const String path)
+{
+	Dictionary result;
+
+	if (!config.offlineRendering)
+	{
+		Godot::print_warning("replay_call_log needs offline rendering to be enabled in the project settings",
+							 __FUNCTION__, __FILE__, __LINE__);
+		return result;
+	}
+
+	if (WwiseCallLog::isRecording())
+	{
+		Godot::print_warning("Stop the call recording before replaying a call log", __FUNCTION__, __FILE__, __LINE__);
+		return result;
+	}
+
+	std::vector<WwiseCallLog::Call> calls;
+	std::vector<Node*> gameObjects;
+
+	const bool loaded = WwiseCallLog::load(path, calls, gameObjects);
+
+	if (!loaded)
+	{
+		Godot::print_error("Failed to read the call log " + path, __FUNCTION__, __FILE__, __LINE__);
+	}
+
+	size_t callIndex = 0;
+	uint32_t numFrames = 0;
+	int64_t peakFrameUsec = 0;
+	const int64_t startUsec = GetTicksUsec();
+
+	// Every recorded frame renders one audio frame, frames without calls included
+	while (loaded && callIndex < calls.size())
+	{
+		const int64_t frameStartUsec = GetTicksUsec();
+
+		for (; callIndex < calls.size() && calls[callIndex].frame == numFrames; ++callIndex)
+		{
+			callv(calls[callIndex].method, calls[callIndex].arguments);
+		}
+
+		processFrame();
+
+		// The physics frame is not stepped during a replay, occlusion advances by the offline frame time instead
+		if (!occlusionManager.empty())
+		{
+			updateOcclusion(offlineFrameTime);
+		}
+
+		renderAudio();
+
+		const int64_t frameUsec = GetTicksUsec() - frameStartUsec;
+
+		if (frameUsec > peakFrameUsec)
+		{
+			peakFrameUsec = frameUsec;
+		}
+
+		++numFrames;
+	}
+
+	const int64_t totalUsec = GetTicksUsec() - startUsec;
+
+	// Rooms are only known to Spatial Audio, so the ones the log left behind are taken from its calls
+	std::unordered_set<const Object*> rooms;
+
+	for (size_t i = 0; i < callIndex; ++i)
+	{
+		if (calls[i].arguments.empty())
+		{
+			continue;
+		}
+
+		if (calls[i].method == "set_room")
+		{
+			rooms.insert(static_cast<Object*>(calls[i].arguments[0]));
+		}
+		else if (calls[i].method == "remove_room")
+		{
+			rooms.erase(static_cast<Object*>(calls[i].arguments[0]));
+		}
+	}
+
+	// Logs do not always unregister everything they registered
+	for (Node* gameObject : gameObjects)
+	{
+		const AkGeometrySetID geometrySetID = static_cast<AkGeometrySetID>(gameObject->get_instance_id());
+		bool hasGeometry = false;
+
+		{
+			AkAutoLock<CAkLock> scopedLock(geometryLock);
+			hasGeometry = geometryCache.count(geometrySetID) > 0;
+		}
+
+		{
+			AkAutoLock<CAkLock> scopedLock(geometryJobLock);
+			hasGeometry = hasGeometry || geometryJobTickets.count(geometrySetID) > 0;
+		}
+
+		if (hasGeometry)
+		{
+			removeGeometry(gameObject);
+		}
+
+		if (rooms.count(gameObject) > 0)
+		{
+			removeRoom(gameObject);
+		}
+
+		removeClusteredEmitter(gameObject);
+		unregisterGameObject(gameObject);
+		gameObject->free();
+	}
+
+	if (!loaded)
+	{
+		return result;
+	}
+
+	result["frames"] = numFrames;
+	result["calls"] = static_cast<int64_t>(calls.size());
+	result["game_objects"] = static_cast<int64_t>(gameObjects.size());
+	result["total_ms"] = static_cast<float>(totalUsec) / 1000.0f;
+	result["average_frame_ms"] = numFrames > 0 ? static_cast<float>(totalUsec) / 1000.0f / numFrames : 0.0f;
+	result["peak_frame_ms"] = static_cast<float>(peakFrameUsec) / 1000.0f;
+
+	return result;
+}
+
+#if defined(WWISE_BENCHMARKS)
+Dictionary Wwise::runBenchmarks(const Dictionary options)
+{
+	return WwiseBenchmarks::run(*this, options);
+}
+#endif
+
+bool Wwise::submitMeshGeometry(const Mesh* mesh, const Transform& transform, const Resource* acousticTexture,
+							   const Array& surfaceTextures, const float occlusionValue, const Object* gameObject,
+							   bool enableDiffraction, bool enableDiffractionOnBoundaryEdges,
+							   const Object* associatedRoom, const bool async)
+{
+	AKASSERT(mesh);
+	AKASSERT(gameObject);
+
+	PoolVector3Array vertices;
+	PoolIntArray triangles;
+	std::vector<AkSurfIdx> triangleSurfaces;
+
+	if (!WwiseGeometryBuilder::gatherMesh(mesh, vertices, triangles, triangleSurfaces))
+	{
+		Godot::print_error("Mesh " + String::num_int64(gameObject->get_instance_id()) + " has no triangles",
+						   __FUNCTION__, __FILE__, __LINE__);
+		return false;
+	}
+
+	const int surfaceCount = static_cast<int>(mesh->get_surface_count());
+	Array textures = surfaceTextures;
+	textures.resize(surfaceCount);
+
+	// Surfaces without a texture in the table fall back to the acoustic_texture metadata of their material
+	for (int surface = 0; surface < surfaceCount; ++surface)
+	{
+		if (textures[surface].get_type() != Variant::NIL)
+		{
+			continue;
+		}
+
+		const Ref<Material> material = mesh->surface_get_material(surface);
+
+		if (material.is_valid() && material->has_meta("acoustic_texture"))
+		{
+			textures[surface] = material->get_meta("acoustic_texture");
+		}
+	}
+
+	return submitGeometry(vertices, triangles, triangleSurfaces, surfaceCount, transform, acousticTexture, textures,
+						  occlusionValue, gameObject, enableDiffraction, enableDiffractionOnBoundaryEdges,
+						  associatedRoom, async);
+}
+
+bool Wwise::submitGeometry(const PoolVector3Array& vertices, const PoolIntArray& triangles,
+						   const std::vector<AkSurfIdx>& triangleSurfaces, const int surfaceCount,
+						   const Transform& transform, const Resource* acousticTexture, const Array& surfaceTextures,
+						   const float occlusionValue, const Object* gameObject, bool enableDiffraction,
+						   bool enableDiffractionOnBoundaryEdges, const Object* associatedRoom, const bool async)
+{
+	WwiseGeometryJob job;
+	job.geometrySetID = static_cast<AkGeometrySetID>(gameObject->get_instance_id());
+	job.vertices = vertices;
+	job.triangles = triangles;
+	job.triangleSurfaces = triangleSurfaces;
+	job.weldTolerance = config.geometryWeldTolerance;
+	job.geometry.data.surfaceCount = surfaceCount;
+
+	prepareGeometry(job.geometry, transform, acousticTexture, surfaceTextures, occlusionValue, enableDiffraction,
+					enableDiffractionOnBoundaryEdges, associatedRoom);
+
+	{
+		AkAutoLock<CAkLock> scopedLock(geometryLock);
+		auto simplification = geometrySimplifications.find(job.geometrySetID);
+
+		if (simplification != geometrySimplifications.end())
+		{
+			job.simplification = simplification->second;
+		}
+	}
+
+	if (async)
+	{
+		return queueGeometryJob(job);
+	}
+
+	// A pending async request would otherwise replace this geometry once it is built
+	cancelGeometryJob(job.geometrySetID);
+
+	// Built outside the geometry lock so RenderAudio is not held up by it
+	WwiseGeometryBuilder::build(job);
+
+	return commitGeometry(job);
+}
+
+void Wwise::prepareGeometry(WwiseCachedGeometry& geometry, const Transform& transform,
+							const Resource* acousticTexture, const Array& surfaceTextures, const float occlusionValue,
+							bool enableDiffraction, bool enableDiffractionOnBoundaryEdges,
+							const Object* associatedRoom)
+{
+	geometry.surfaces.resize(geometry.data.surfaceCount);
+	geometry.surfaceNames.resize(geometry.data.surfaceCount);
+
+	for (int surface = 0; surface < geometry.data.surfaceCount; ++surface)
+	{
+		const Resource* texture = nullptr;
+
+		if (surface < surfaceTextures.size())
+		{
+			const Object* object = surfaceTextures[surface];
+			texture = Object::cast_to<Resource>(object);
+		}
+
+		// Surfaces without an acoustic texture still carry the occlusion value
+		AkAcousticSurface& akSurface = geometry.surfaces[surface];
+		akSurface.textureID = AK_INVALID_UNIQUE_ID;
+		akSurface.occlusion = occlusionValue;
+		akSurface.strName = nullptr;
+
+		// The texture baked from the mesh material ranks between the table and the acoustic texture of the set
+		if (!texture && static_cast<size_t>(surface) < geometry.data.surfaceTextureIDs.size() &&
+			geometry.data.surfaceTextureIDs[surface] != AK_INVALID_UNIQUE_ID)
+		{
+			akSurface.textureID = geometry.data.surfaceTextureIDs[surface];
+			continue;
+		}
+
+		texture = texture ? texture : acousticTexture;
+
+		if (texture)
+		{
+			// Not possible to get the acoustic texture values through AK::SoundEngine, maybe looking at WAAPI, only
+			// the ID is passed to Wwise
+			const String textureName = texture->get("name");
+			geometry.surfaceNames[surface] = textureName.utf8();
+			akSurface.textureID = AK::SoundEngine::GetIDFromString(geometry.surfaceNames[surface].get_data());
+		}
+	}
+
+	geometry.enableDiffraction = enableDiffraction;
+	geometry.enableDiffractionOnBoundaryEdges = enableDiffractionOnBoundaryEdges;
+	geometry.roomID = associatedRoom ? static_cast<AkRoomID>(associatedRoom->get_instance_id()) : AkRoomID();
+	geometry.transform = transform;
+}
+
+bool Wwise::commitGeometry(WwiseGeometryJob& job)
+{
+	const WwiseGeometryData& data = job.geometry.data;
+
+	if (!job.built)
+	{
+		Godot::print_error("Mesh " + String::num_int64(job.geometrySetID) +
+							   " has too many vertices or triangles for a Wwise geometry set, even once simplified",
+						   __FUNCTION__, __FILE__, __LINE__);
+		return false;
+	}
+
+	if (data.degenerateTriangles > 0 || data.invalidTriangles > 0)
+	{
+		Godot::print("Skipped {0} degenerate and {1} invalid triangles on mesh {2}", data.degenerateTriangles,
+					 data.invalidTriangles, String::num_int64(job.geometrySetID));
+	}
+
+	return cacheGeometry(job.geometrySetID, job.geometry);
+}
+
+bool Wwise::cacheGeometry(const AkGeometrySetID geometrySetID, WwiseCachedGeometry& geometry)
+{
+	AkAutoLock<CAkLock> scopedLock(geometryLock);
+
+	WwiseCachedGeometry& cachedGeometry = geometryCache[geometrySetID];
+	cachedGeometry = std::move(geometry);
+
+	return uploadGeometry(geometrySetID, cachedGeometry);
+}
+
+bool Wwise::uploadGeometry(const AkGeometrySetID geometrySetID, WwiseCachedGeometry& geometry)
+{
+	WwiseGeometryBuilder::transformVertices(geometry.data.vertices, geometry.transform, transformedVertices);
+
+	for (size_t i = 0; i < geometry.surfaces.size(); ++i)
+	{
+		const CharString& surfaceName = geometry.surfaceNames[i];
+		geometry.surfaces[i].strName = surfaceName.length() > 0 ? surfaceName.get_data() : nullptr;
+	}
+
+	AkGeometryParams params;
+	params.Vertices = transformedVertices.data();
+	params.NumVertices = static_cast<AkVertIdx>(transformedVertices.size());
+	params.Triangles = geometry.data.triangles.data();
+	params.NumTriangles = static_cast<AkTriIdx>(geometry.data.triangles.size());
+	params.Surfaces = geometry.surfaces.empty() ? nullptr : geometry.surfaces.data();
+	params.NumSurfaces = static_cast<AkSurfIdx>(geometry.surfaces.size());
+	params.EnableDiffraction = geometry.enableDiffraction;
+	params.EnableDiffractionOnBoundaryEdges = geometry.enableDiffractionOnBoundaryEdges;
+	params.RoomID = geometry.roomID;
+
+	return ERROR_CHECK(AK::SpatialAudio::SetGeometry(geometrySetID, params), "Failed to register geometry");
+}
+
+void Wwise::flushGeometryTransforms()
+{
+	AkAutoLock<CAkLock> scopedLock(geometryLock);
+
+	// Each moved geometry set is uploaded once per audio frame, with the last transform it was given
+	for (const AkGeometrySetID geometrySetID : pendingGeometryTransforms)
+	{
+		auto geometry = geometryCache.find(geometrySetID);
+
+		if (geometry != geometryCache.end() && geometry->second.transformPending)
+		{
+			geometry->second.transformPending = false;
+			uploadGeometry(geometrySetID, geometry->second);
+		}
+	}
+
+	pendingGeometryTransforms.clear();
+}
+
+bool Wwise::queueGeometryJob(WwiseGeometryJob& job)
+{
+	if (!geometryThreadRunning && !startGeometryThread())
 	{
-		AkMusicSyncCallbackInfo* musicSyncInfo = static_cast<AkMusicSyncCallbackInfo*>(callbackInfo);
-		signalData["gameObjID"] = static_cast<unsigned int>(musicSyncInfo->gameObjID);
-		signalData["musicSyncType"] = static_cast<unsigned int>(musicSyncInfo->musicSyncType);
-		signalData["playingID"] = static_cast<unsigned int>(musicSyncInfo->playingID);
-		signalData["pszUserCueName"] = String(musicSyncInfo->pszUserCueName);
+		Godot::print_warning("Failed to start the geometry thread, building the geometry on the main thread instead",
+							 __FUNCTION__, __FILE__, __LINE__);
+		WwiseGeometryBuilder::build(job);
+	}
 
-		Dictionary segmentInfo;
-		segmentInfo["fBarDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fBarDuration);
-		segmentInfo["fBeatDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fBeatDuration);
-		segmentInfo["fGridDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fGridDuration);
-		segmentInfo["fGridOffset"] = static_cast<float>(musicSyncInfo->segmentInfo.fGridOffset);
-		segmentInfo["iActiveDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iActiveDuration);
-		segmentInfo["iCurrentPosition"] = static_cast<int>(musicSyncInfo->segmentInfo.iCurrentPosition);
-		segmentInfo["iPostExitDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iPostExitDuration);
-		segmentInfo["iPreEntryDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iPreEntryDuration);
-		segmentInfo["iRemainingLookAheadTime"] = static_cast<int>(musicSyncInfo->segmentInfo.iRemainingLookAheadTime);
-		signalData["segmentInfo"] = segmentInfo;
-		break;
+	AkAutoLock<CAkLock> scopedLock(geometryJobLock);
+
+	job.ticket = ++nextGeometryJobTicket;
+	geometryJobTickets[job.geometrySetID] = job.ticket;
+
+	if (job.built)
+	{
+		builtGeometryJobs.push_back(std::move(job));
+		return true;
 	}
-	case AK_MusicSyncPoint:
+
+	geometryJobs.push_back(std::move(job));
+	AKPLATFORM::AkSignalEvent(geometryJobEvent);
+
+	return true;
+}
+
+void Wwise::cancelGeometryJob(const AkGeometrySetID geometrySetID)
+{
+	// Jobs already queued or built are dropped when they are committed
+	AkAutoLock<CAkLock> scopedLock(geometryJobLock);
+	geometryJobTickets.erase(geometrySetID);
+}
+
+void Wwise::commitGeometryJobs()
+{
+	std::vector<WwiseGeometryJob> jobs;
+
 	{
-		AkMusicSyncCallbackInfo* musicSyncInfo = static_cast<AkMusicSyncCallbackInfo*>(callbackInfo);
-		signalData["gameObjID"] = static_cast<unsigned int>(musicSyncInfo->gameObjID);
-		signalData["musicSyncType"] = static_cast<unsigned int>(musicSyncInfo->musicSyncType);
-		signalData["playingID"] = static_cast<unsigned int>(musicSyncInfo->playingID);
-		signalData["pszUserCueName"] = String(musicSyncInfo->pszUserCueName);
+		AkAutoLock<CAkLock> scopedLock(geometryJobLock);
 
-		Dictionary segmentInfo;
-		segmentInfo["fBarDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fBarDuration);
-		segmentInfo["fBeatDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fBeatDuration);
-		segmentInfo["fGridDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fGridDuration);
-		segmentInfo["fGridOffset"] = static_cast<float>(musicSyncInfo->segmentInfo.fGridOffset);
-		segmentInfo["iActiveDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iActiveDuration);
-		segmentInfo["iCurrentPosition"] = static_cast<int>(musicSyncInfo->segmentInfo.iCurrentPosition);
-		segmentInfo["iPostExitDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iPostExitDuration);
-		segmentInfo["iPreEntryDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iPreEntryDuration);
-		segmentInfo["iRemainingLookAheadTime"] = static_cast<int>(musicSyncInfo->segmentInfo.iRemainingLookAheadTime);
-		signalData["segmentInfo"] = segmentInfo;
-		break;
+		// Uploads are spread over frames so streaming in many meshes at once does not stall a single one
+		while (!builtGeometryJobs.empty() &&
+			   (config.geometryCommitsPerFrame == 0 || jobs.size() < config.geometryCommitsPerFrame))
+		{
+			WwiseGeometryJob& job = builtGeometryJobs.front();
+			auto ticket = geometryJobTickets.find(job.geometrySetID);
+
+			if (ticket != geometryJobTickets.end() && ticket->second == job.ticket)
+			{
+				geometryJobTickets.erase(ticket);
+				jobs.push_back(std::move(job));
+			}
+
+			builtGeometryJobs.pop_front();
+		}
 	}
-	case AK_MusicSyncAll:
+
+	for (WwiseGeometryJob& job : jobs)
 	{
-		AkMusicSyncCallbackInfo* musicSyncInfo = static_cast<AkMusicSyncCallbackInfo*>(callbackInfo);
-		signalData["gameObjID"] = static_cast<unsigned int>(musicSyncInfo->gameObjID);
-		signalData["musicSyncType"] = static_cast<unsigned int>(musicSyncInfo->musicSyncType);
-		signalData["playingID"] = static_cast<unsigned int>(musicSyncInfo->playingID);
-		signalData["pszUserCueName"] = String(musicSyncInfo->pszUserCueName);
+		Dictionary signalData;
+		signalData["gameObjectID"] = static_cast<int64_t>(job.geometrySetID);
+		signalData["result"] = commitGeometry(job);
 
-		Dictionary segmentInfo;
-		segmentInfo["fBarDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fBarDuration);
-		segmentInfo["fBeatDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fBeatDuration);
-		segmentInfo["fGridDuration"] = static_cast<float>(musicSyncInfo->segmentInfo.fGridDuration);
-		segmentInfo["fGridOffset"] = static_cast<float>(musicSyncInfo->segmentInfo.fGridOffset);
-		segmentInfo["iActiveDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iActiveDuration);
-		segmentInfo["iCurrentPosition"] = static_cast<int>(musicSyncInfo->segmentInfo.iCurrentPosition);
-		segmentInfo["iPostExitDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iPostExitDuration);
-		segmentInfo["iPreEntryDuration"] = static_cast<int>(musicSyncInfo->segmentInfo.iPreEntryDuration);
-		segmentInfo["iRemainingLookAheadTime"] = static_cast<int>(musicSyncInfo->segmentInfo.iRemainingLookAheadTime);
-		signalData["segmentInfo"] = segmentInfo;
-		break;
+		emit_signal("geometry_callback", signalData);
 	}
-	case AK_MIDIEvent:
+}
+
+bool Wwise::startGeometryThread()
+{
+	AKASSERT(!geometryThreadRunning);
+
+	if (AKPLATFORM::AkCreateEvent(geometryJobEvent) != AK_Success)
 	{
-		AkMIDIEventCallbackInfo* midiEventInfo = static_cast<AkMIDIEventCallbackInfo*>(callbackInfo);
-		signalData["eventID"] = static_cast<unsigned int>(midiEventInfo->eventID);
-		signalData["gameObjID"] = static_cast<unsigned int>(midiEventInfo->gameObjID);
+		return false;
+	}
 
-		Dictionary midiEvent;
-		midiEvent["byType"] = static_cast<unsigned char>(midiEventInfo->midiEvent.byType);
-		midiEvent["byChan"] = static_cast<unsigned char>(midiEventInfo->midiEvent.byChan);
+	geometryThreadRunning = true;
 
-		Dictionary cc;
-		cc["byCc"] = static_cast<unsigned char>(midiEventInfo->midiEvent.Cc.byCc);
-		cc["byValue"] = static_cast<unsigned char>(midiEventInfo->midiEvent.Cc.byValue);
+	AkThreadProperties geometryThreadProperties;
+	AKPLATFORM::AkGetDefaultThreadProperties(geometryThreadProperties);
+
+	AKPLATFORM::AkCreateThread(geometryThreadRoutine, this, geometryThreadProperties, &geometryThread,
+							   "Wwise Geometry");
+
+	if (!AKPLATFORM::AkIsValidThread(&geometryThread))
+	{
+		geometryThreadRunning = false;
+		AKPLATFORM::AkDestroyEvent(geometryJobEvent);
+		return false;
+	}
+
+	return true;
+}
+
+void Wwise::stopGeometryThread()
+{
+	if (!AKPLATFORM::AkIsValidThread(&geometryThread))
+	{
+		return;
+	}
+
+	geometryThreadRunning = false;
+	AKPLATFORM::AkSignalEvent(geometryJobEvent);
+	AKPLATFORM::AkWaitForSingleThread(&geometryThread);
+	AKPLATFORM::AkCloseThread(&geometryThread);
+	AKPLATFORM::AkClearThread(&geometryThread);
+	AKPLATFORM::AkDestroyEvent(geometryJobEvent);
+
+	AkAutoLock<CAkLock> scopedLock(geometryJobLock);
+	geometryJobs.clear();
+	builtGeometryJobs.clear();
+	geometryJobTickets.clear();
+}
+
+AK_DECLARE_THREAD_ROUTINE(Wwise::geometryThreadRoutine)
+{
+	Wwise* wwise = static_cast<Wwise*>(AK_THREAD_ROUTINE_PARAMETER);
+	AKASSERT(wwise);
+
+	while (wwise->geometryThreadRunning)
+	{
+		AKPLATFORM::AkWaitForEvent(wwise->geometryJobEvent);
+
+		// Drain the queue, a single wake up can stand for several queued jobs
+		while (wwise->geometryThreadRunning)
+		{
+			WwiseGeometryJob job;
+
+			{
+				AkAutoLock<CAkLock> scopedLock(wwise->geometryJobLock);
+
+				if (wwise->geometryJobs.empty())
+				{
+					break;
+				}
+
+				job = std::move(wwise->geometryJobs.front());
+				wwise->geometryJobs.pop_front();
+			}
+
+			WwiseGeometryBuilder::build(job);
+
+			AkAutoLock<CAkLock> scopedLock(wwise->geometryJobLock);
+			wwise->builtGeometryJobs.push_back(std::move(job));
+		}
+	}
+
+	AK_RETURN_THREAD_OK;
+}
+
+void Wwise::resolveRooms()
+{
+	roomChanges.clear();
+	roomResolver.resolve(roomChanges);
+
+	// Only game objects that changed room are sent, the room of everything else is already right
+	for (const WwiseRoomResolver::RoomChange& change : roomChanges)
+	{
+		sendGameObjectRoom(static_cast<AkGameObjectID>(change.gameObjectID), change.roomID);
+	}
+}
+
+void Wwise::sendGameObjectRoom(const AkGameObjectID gameObjectID, const uint64_t roomID)
+{
+	const AkRoomID akRoomID = roomID != WwiseRoomResolver::NO_ROOM ? static_cast<AkRoomID>(roomID)
+																	: static_cast<AkRoomID>(INVALID_ROOM_ID);
+
+	ERROR_CHECK(AK::SpatialAudio::SetGameObjectInRoom(gameObjectID, akRoomID),
+				"Failed to set Game Object in Room: " + String::num_int64(gameObjectID));
+}
+
+void Wwise::updateEnvironments()
+{
+	static_assert(WwiseEnvironmentManager::MAX_SENDS <= AK_MAX_ENVIRONMENTS,
+				  "Environment sends are expected to fit AK_MAX_ENVIRONMENTS");
+
+	environmentChanges.clear();
+	environmentManager.update(environmentChanges);
+
+	// Game objects whose sends did not change since the last update are not sent again
+	for (const WwiseEnvironmentManager::SendChange& change : environmentChanges)
+	{
+		AkAuxSendValue environments[AK_MAX_ENVIRONMENTS];
+
+		for (int i = 0; i < change.sendCount; ++i)
+		{
+			environments[i].auxBusID = static_cast<AkAuxBusID>(change.sends[i].auxBusID);
+			environments[i].fControlValue = change.sends[i].controlValue;
+			environments[i].listenerID = AK_INVALID_GAME_OBJECT;
+		}
+
+		ERROR_CHECK(AK::SoundEngine::SetGameObjectAuxSendValues(static_cast<AkGameObjectID>(change.gameObjectID),
+																environments, change.sendCount),
+					"Could not set the Game Object Aux Send Values: " + String::num_int64(change.gameObjectID));
+	}
+}
+
+void Wwise::updateOcclusion(const float delta)
+{
+	occlusionChanges.clear();
+	occlusionManager.update(
+		config.occlusionRaysPerFrame, delta, config.occlusionSmoothingTime,
+		[this](const uint64_t emitterID, const Vector3& from, const Vector3& to, const unsigned int maxRays) {
+			return castOcclusionRay(emitterID, from, to, maxRays);
+		},
+		occlusionChanges);
+
+	// Obstruction and occlusion get the same value, as they did when AkEvent cast the rays
+	for (const WwiseOcclusionManager::OcclusionChange& change : occlusionChanges)
+	{
+		ERROR_CHECK(AK::SoundEngine::SetObjectObstructionAndOcclusion(static_cast<AkGameObjectID>(change.emitterID),
+																	 static_cast<AkGameObjectID>(change.listenerID),
+																	 change.occlusion, change.occlusion),
+					"Could not set Obstruction and Occlusion: " + String::num_int64(change.emitterID));
+	}
+}
+
+WwiseOcclusionManager::RayResult Wwise::castOcclusionRay(const uint64_t emitterID, const Vector3& from,
+														 const Vector3& to, const unsigned int maxRays)
+{
+	WwiseOcclusionManager::RayResult rayResult{0.0f, 0, true};
+	auto world = occlusionWorlds.find(emitterID);
+
+	if (world == occlusionWorlds.end() || !world->second.is_valid())
+	{
+		return rayResult;
+	}
+
+	PhysicsDirectSpaceState* spaceState = world->second->get_direct_space_state();
+
+	if (!spaceState || config.occlusionPerHit <= 0.0f)
+	{
+		return rayResult;
+	}
+
+	// Each collider between the emitter and its listener adds to the occlusion, colliders already hit are excluded
+	// from the next ray so the count stops once the occlusion is full. Every ray counts against maxRays.
+	occlusionExclusions.clear();
+
+	while (rayResult.occlusion < 1.0f)
+	{
+		if (maxRays > 0 && rayResult.rays >= maxRays)
+		{
+			rayResult.complete = false;
+			break;
+		}
+
+		const Dictionary result = spaceState->intersect_ray(from, to, occlusionExclusions,
+															 static_cast<int64_t>(config.occlusionCollisionMask));
+		++rayResult.rays;
+
+		if (result.empty())
+		{
+			break;
+		}
+
+		occlusionExclusions.append(result["rid"]);
+		rayResult.occlusion += config.occlusionPerHit;
+	}
+
+	rayResult.occlusion = std::min(rayResult.occlusion, 1.0f);
+	return rayResult;
+}
+
+void Wwise::updateEmitterLod()
+{
+	lodDueEmitters.clear();
+	lodActivityChanges.clear();
+	emitterLod.update(lodDueEmitters, lodActivityChanges);
+
+	for (const uint64_t emitterID : lodDueEmitters)
+	{
+		ERROR_CHECK(setSoundEnginePosition(static_cast<AkGameObjectID>(emitterID), *emitterLod.getTransform(emitterID)),
+					"Game object ID " + String::num_int64(emitterID));
+	}
+
+	// Suspended emitters are out of audible range, their occlusion can wait until they are resumed
+	for (const WwiseEmitterLod::ActivityChange& change : lodActivityChanges)
+	{
+		occlusionManager.setActive(change.emitterID, change.active);
+	}
+}
+
+void Wwise::updateEmitterClusters()
+{
+	clusterChanges.clear();
+	emitterClusters.update(clusterChanges);
+
+	for (const WwiseEmitterClusters::ClusterChange& change : clusterChanges)
+	{
+		const AkGameObjectID clusterID = static_cast<AkGameObjectID>(change.clusterID);
+
+		switch (change.type)
+		{
+		case WwiseEmitterClusters::CLUSTER_CREATED:
+		{
+			if (ERROR_CHECK(AK::SoundEngine::RegisterGameObj(clusterID, "Emitter Cluster"),
+							"Failed to register Emitter Cluster: " + String::num_int64(change.clusterID)) &&
+				AK::SoundEngine::PostEvent(change.eventID, clusterID) == AK_INVALID_PLAYING_ID)
+			{
+				ERROR_CHECK(AK_InvalidID, change.eventID);
+			}
+			break;
+		}
+		case WwiseEmitterClusters::CLUSTER_MOVED:
+		{
+			clusterTransforms.clear();
+			emitterClusters.getTransforms(change.clusterID, clusterTransforms);
+
+			// One voice plays every emitter of the cluster, each position being a source of its own
+			const size_t positionCount =
+				std::min<size_t>(clusterTransforms.size(), std::numeric_limits<AkUInt16>::max());
+			clusterPositions.resize(positionCount);
+
+			for (size_t i = 0; i < positionCount; ++i)
+			{
+				AkVector position;
+				GetAkVector(clusterTransforms[i], position, VectorType::POSITION);
+				AkVector forward;
+				GetAkVector(clusterTransforms[i], forward, VectorType::FORWARD);
+				AkVector up;
+				GetAkVector(clusterTransforms[i], up, VectorType::UP);
+
+				clusterPositions[i].Set(position, forward, up);
+			}
+
+			ERROR_CHECK(AK::SoundEngine::SetMultiplePositions(clusterID, clusterPositions.data(),
+															  static_cast<AkUInt16>(positionCount),
+															  AK::SoundEngine::MultiPositionType_MultiSources),
+						"Failed to set Emitter Cluster positions: " + String::num_int64(change.clusterID));
+			break;
+		}
+		case WwiseEmitterClusters::CLUSTER_REMOVED:
+		{
+			AK::SoundEngine::StopAll(clusterID);
+			ERROR_CHECK(AK::SoundEngine::UnregisterGameObj(clusterID),
+						"Failed to unregister Emitter Cluster: " + String::num_int64(change.clusterID));
+			break;
+		}
+		}
+	}
+}
+
+AKRESULT Wwise::setSoundEnginePosition(const AkGameObjectID gameObjectID, const Transform& transform)
+{
+	AkSoundPosition soundPos;
+
+	AkVector position;
+	GetAkVector(transform, position, VectorType::POSITION);
+	AkVector forward;
+	GetAkVector(transform, forward, VectorType::FORWARD);
+	AkVector up;
+	GetAkVector(transform, up, VectorType::UP);
+
+	soundPos.Set(position, forward, up);
+
+	return AK::SoundEngine::SetPosition(gameObjectID, soundPos);
+}
+
+void Wwise::renderAudio()
+{
+	WWISE_TRACE_SCOPE("render_audio");
+
+	flushGeometryTransforms();
+
+	const int64_t renderStartUsec = GetTicksUsec();
+	const int64_t firstCommandSubmissionUsec = firstCommandUsec.exchange(0);
+
+	ERROR_CHECK(AK::SoundEngine::RenderAudio(), "");
+
+	const int64_t renderEndUsec = GetTicksUsec();
+
+	AkAutoLock<CAkLock> ScopedLock(statsLock);
+	renderAudioTiming.record(renderEndUsec - renderStartUsec);
+
+	if (firstCommandSubmissionUsec != 0)
+	{
+		commandLatencyTiming.record(renderStartUsec - firstCommandSubmissionUsec);
+	}
+}
+
+void Wwise::noteCommandSubmission()
+{
+	// Only the first command since the last RenderAudio matters, it is the one that waits the longest in the queue
+	if (firstCommandUsec.load(std::memory_order_relaxed) == 0)
+	{
+		int64_t expected = 0;
+		firstCommandUsec.compare_exchange_strong(expected, GetTicksUsec());
+	}
+}
+
+bool Wwise::startRenderThread()
+{
+	AKASSERT(!renderThreadRunning);
+
+	renderThreadRunning = true;
+
+	AkThreadProperties renderThreadProperties;
+	AKPLATFORM::AkGetDefaultThreadProperties(renderThreadProperties);
+	renderThreadProperties.nPriority = AK_THREAD_PRIORITY_ABOVE_NORMAL;
+
+	AKPLATFORM::AkCreateThread(renderThreadRoutine, this, renderThreadProperties, &renderThread, "Wwise Render");
+
+	if (!AKPLATFORM::AkIsValidThread(&renderThread))
+	{
+		renderThreadRunning = false;
+		return false;
+	}
+
+	return true;
+}
+
+void Wwise::stopRenderThread()
+{
+	if (!AKPLATFORM::AkIsValidThread(&renderThread))
+	{
+		return;
+	}
+
+	endCommandBatch();
+
+	renderThreadRunning = false;
+	AKPLATFORM::AkWaitForSingleThread(&renderThread);
+	AKPLATFORM::AkCloseThread(&renderThread);
+	AKPLATFORM::AkClearThread(&renderThread);
+}
+
+AK_DECLARE_THREAD_ROUTINE(Wwise::renderThreadRoutine)
+{
+	Wwise* wwise = static_cast<Wwise*>(AK_THREAD_ROUTINE_PARAMETER);
+	AKASSERT(wwise);
+
+	// Defaults to one tick per audio frame
+	const float tickRate = wwise->config.renderTickRate > 0.0f
+							   ? wwise->config.renderTickRate
+							   : static_cast<float>(wwise->sampleRate) / static_cast<float>(wwise->numSamplesPerFrame);
+	const std::chrono::microseconds tickPeriod(static_cast<int64_t>(1000000.0f / tickRate));
 
-		Dictionary chanAftertouch;
-		chanAftertouch["byValue"] = static_cast<unsigned char>(midiEventInfo->midiEvent.ChanAftertouch.byValue);
+	// How often a tick held back by a command batch checks whether the batch ended
+	const std::chrono::microseconds batchRetryPeriod(250);
 
-		Dictionary gen;
-		gen["byParam1"] = static_cast<unsigned char>(midiEventInfo->midiEvent.Gen.byParam1);
-		gen["byParam2"] = static_cast<unsigned char>(midiEventInfo->midiEvent.Gen.byParam2);
+	std::chrono::steady_clock::time_point nextTick = std::chrono::steady_clock::now() + tickPeriod;
 
-		Dictionary noteAftertouch;
-		noteAftertouch["byNote"] = static_cast<unsigned char>(midiEventInfo->midiEvent.NoteAftertouch.byNote);
-		noteAftertouch["byValue"] = static_cast<unsigned char>(midiEventInfo->midiEvent.NoteAftertouch.byValue);
+	while (wwise->renderThreadRunning)
+	{
+		std::this_thread::sleep_until(nextTick);
 
-		Dictionary noteOnOff;
-		noteOnOff["byNote"] = static_cast<unsigned char>(midiEventInfo->midiEvent.NoteOnOff.byNote);
-		noteOnOff["byVelocity"] = static_cast<unsigned char>(midiEventInfo->midiEvent.NoteOnOff.byVelocity);
+		const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
 
-		Dictionary pitchBend;
-		pitchBend["byValueLsb"] = static_cast<unsigned char>(midiEventInfo->midiEvent.PitchBend.byValueLsb);
-		pitchBend["byValueMsb"] = static_cast<unsigned char>(midiEventInfo->midiEvent.PitchBend.byValueMsb);
+		{
+			AkAutoLock<CAkLock> ScopedLock(wwise->commandSubmissionLock);
 
-		Dictionary programChange;
-		programChange["byProgramNum"] = static_cast<unsigned char>(midiEventInfo->midiEvent.ProgramChange.byProgramNum);
+			if (wwise->commandBatchOpen && now - wwise->commandBatchStart < tickPeriod)
+			{
+				nextTick = now + batchRetryPeriod;
+				continue;
+			}
 
-		midiEvent["cc"] = cc;
-		midiEvent["chanAftertouch"] = chanAftertouch;
-		midiEvent["gen"] = gen;
-		midiEvent["noteAftertouch"] = noteAftertouch;
-		midiEvent["noteOnOff"] = noteOnOff;
-		midiEvent["pitchBend"] = pitchBend;
-		midiEvent["programChange"] = programChange;
+			wwise->renderAudio();
+		}
 
-		signalData["midiEvent"] = midiEvent;
+		nextTick += tickPeriod;
 
-		signalData["playingID"] = static_cast<unsigned int>(midiEventInfo->playingID);
-		break;
+		// Skip ticks that were missed instead of rendering them back to back
+		if (nextTick < now)
+		{
+			nextTick = now + tickPeriod;
+		}
 	}
-	case AK_CallbackBits:
-	case AK_EnableGetSourcePlayPosition:
-	case AK_EnableGetMusicPlayPosition:
-	case AK_EnableGetSourceStreamBuffering:
-		break;
-	default:
-		AKASSERT(false);
-		break;
+
+	AK_RETURN_THREAD_OK;
+}
+
+bool Wwise::isServerModeRequested()
+{
+	if (config.serverMode)
+	{
+		return true;
 	}
 
-	if (signalDataArray->size() < signalCallbackDataMaxSize)
+	OS* os = OS::get_singleton();
+
+	// Server builds, export presets with the custom feature, or --wwise-server after -- on the command line
+	if (os->has_feature("Server") || os->has_feature(WWISE_SERVER_FEATURE))
 	{
-		signalDataArray->append(signalData);
+		return true;
 	}
-	else
+
+	const PoolStringArray arguments = os->get_cmdline_args();
+
+	for (int i = 0; i < arguments.size(); ++i)
 	{
-		Godot::print_warning("Exceeded the signal callback data maximum size (callback manager)", __FUNCTION__,
-							 __FILE__, __LINE__);
+		if (arguments[i] == WWISE_SERVER_ARGUMENT)
+		{
+			return true;
+		}
 	}
+
+	return false;
 }
 
-void Wwise::emitSignals()
+void Wwise::setServerGameSync(Dictionary& gameSyncs, const Object* gameObject, const Variant key, const Variant value)
 {
-	AkAutoLock<CAkLock> ScopedLock(signalDataLock);
+	const int64_t gameObjectID =
+		gameObject ? gameObject->get_instance_id() : static_cast<int64_t>(AK_INVALID_GAME_OBJECT);
 
-	const int initialArraySize = signalDataArray->size();
+	Dictionary objectGameSyncs;
 
-	for (int signalIndex = 0; signalIndex < initialArraySize; ++signalIndex)
+	if (gameSyncs.has(gameObjectID))
 	{
-		const Dictionary data = signalDataArray->pop_front();
-		const unsigned int callbackType = static_cast<unsigned int>(data["callbackType"]);
-
-		emit_signal(WwiseCallbackToSignal(static_cast<AkCallbackType>(callbackType)), data);
+		objectGameSyncs = gameSyncs[gameObjectID];
 	}
 
-	AKASSERT(signalDataArray->size() == 0);
+	objectGameSyncs[key] = value;
+	gameSyncs[gameObjectID] = objectGameSyncs;
 }
 
-void Wwise::bankCallback(AkUInt32 bankID, const void* inMemoryBankPtr, AKRESULT loadResult, AkMemPoolId memPoolId)
+Variant Wwise::getServerGameSync(const Dictionary& gameSyncs, const Object* gameObject, const Variant key,
+								 const Variant defaultValue)
 {
-	AkAutoLock<CAkLock> ScopedLock(signalDataLock);
-
-	Dictionary signalData;
-	signalData["bankID"] = static_cast<unsigned int>(bankID);
-	signalData["result"] = static_cast<unsigned int>(loadResult);
+	const int64_t gameObjectID =
+		gameObject ? gameObject->get_instance_id() : static_cast<int64_t>(AK_INVALID_GAME_OBJECT);
 
-	if (signalBankDataArray->size() < signalCallbackDataMaxSize)
-	{
-		signalBankDataArray->append(signalData);
-	}
-	else
+	if (!gameSyncs.has(gameObjectID))
 	{
-		Godot::print_warning("Exceeded the signal callback data maximum size (callback manager)", __FUNCTION__,
-							 __FILE__, __LINE__);
+		return defaultValue;
 	}
-}
 
-void Wwise::emitBankSignals()
-{
-	AkAutoLock<CAkLock> ScopedLock(signalDataLock);
+	const Dictionary objectGameSyncs = gameSyncs[gameObjectID];
 
-	const int initialArraySize = signalBankDataArray->size();
+	return objectGameSyncs.has(key) ? objectGameSyncs[key] : defaultValue;
+}
 
-	for (int signalIndex = 0; signalIndex < initialArraySize; ++signalIndex)
+void Wwise::removeServerGameSyncs(const Object* gameObject)
+{
+	if (!gameObject)
 	{
-		const Dictionary data = signalBankDataArray->pop_front();
-		emit_signal("bank_callback", data);
+		return;
 	}
 
-	AKASSERT(signalBankDataArray->size() == 0);
+	serverSwitches.erase(gameObject->get_instance_id());
+	serverRTPCs.erase(gameObject->get_instance_id());
+}
+
+void Wwise::recordStartupTiming(const String phase, const int64_t startTicksUsec, const int64_t endTicksUsec)
+{
+	startupTimings[phase] = static_cast<float>(endTicksUsec - startTicksUsec) / 1000.0f;
 }
 
 Variant Wwise::getPlatformProjectSetting(const String setting)
@@ -1417,21 +3800,7 @@ Variant Wwise::getPlatformProjectSetting(const String setting)
 	AKASSERT(projectSettings);
 	AKASSERT(!setting.empty());
 
-	String platformSetting = setting;
-
-#ifdef AK_WIN
-	platformSetting += GODOT_WINDOWS_SETTING_POSTFIX;
-#elif defined(AK_MAC_OS_X)
-	platformSetting += GODOT_MAC_OSX_SETTING_POSTFIX;
-#elif defined(AK_IOS)
-	platformSetting += GODOT_IOS_SETTING_POSTFIX;
-#elif defined(AK_ANDROID)
-	platformSetting += GODOT_ANDROID_SETTING_POSTFIX;
-#elif defined(AK_LINUX)
-	platformSetting += GODOT_LINUX_SETTING_POSTFIX;
-#else
-#error "Platform not supported"
-#endif
+	const String platformSetting = setting + platformSettingPostfix;
 
 	// Try to get the platform-specific setting, if it exists
 	if (projectSettings && projectSettings->has_setting(platformSetting))
@@ -1452,15 +3821,189 @@ Variant Wwise::getPlatformProjectSetting(const String setting)
 	}
 }
 
+void Wwise::loadConfig()
+{
+	const String userSettingsPath = WWISE_COMMON_USER_SETTINGS_PATH;
+	const String advancedSettingsPath = WWISE_COMMON_ADVANCED_SETTINGS_PATH;
+	const String userSpatialAudioPath = WWISE_COMMON_USER_SETTINGS_PATH + WWISE_SPATIAL_AUDIO_PATH;
+	const String advancedSpatialAudioPath = WWISE_COMMON_ADVANCED_SETTINGS_PATH + WWISE_SPATIAL_AUDIO_PATH;
+
+	// Common user settings
+	config.basePath = getPlatformProjectSetting(userSettingsPath + "base_path");
+	config.startupLanguage = getPlatformProjectSetting(userSettingsPath + "startup_language");
+	config.callbackManagerBufferSize =
+		static_cast<unsigned int>(getPlatformProjectSetting(userSettingsPath + "callback_manager_buffer_size"));
+	config.engineLogging = static_cast<bool>(getPlatformProjectSetting(userSettingsPath + "engine_logging"));
+	config.loadInitBankAtStartup =
+		static_cast<bool>(getPlatformProjectSetting(userSettingsPath + "load_init_bank_at_startup"));
+	config.audioDeviceShareset = getPlatformProjectSetting(userSettingsPath + "main_output/audio_device_shareset");
+	config.channelConfigType = static_cast<unsigned int>(
+		getPlatformProjectSetting(userSettingsPath + "main_output/channel_config/channel_config_type"));
+	config.numberOfChannels = static_cast<unsigned int>(
+		getPlatformProjectSetting(userSettingsPath + "main_output/channel_config/number_of_channels"));
+	config.deviceID = static_cast<unsigned int>(getPlatformProjectSetting(userSettingsPath + "main_output/device_id"));
+	config.panningRule =
+		static_cast<unsigned int>(getPlatformProjectSetting(userSettingsPath + "main_output/panning_rule"));
+	config.commandQueueSize =
+		static_cast<unsigned int>(getPlatformProjectSetting(userSettingsPath + "command_queue_size"));
+	config.maximumNumberOfPositioningPaths =
+		static_cast<unsigned int>(getPlatformProjectSetting(userSettingsPath + "maximum_number_of_positioning_paths"));
+	config.samplesPerFrame =
+		static_cast<unsigned int>(getPlatformProjectSetting(userSettingsPath + "samples_per_frame"));
+	config.numberOfRefillsInVoice =
+		static_cast<unsigned int>(getPlatformProjectSetting(userSettingsPath + "number_of_refills_in_voice"));
+	config.sampleRate = static_cast<unsigned int>(getPlatformProjectSetting(userSettingsPath + "sample_rate"));
+	config.streamingLookAheadRatio =
+		static_cast<float>(getPlatformProjectSetting(userSettingsPath + "streaming_look_ahead_ratio"));
+	config.renderTickMode = static_cast<unsigned int>(getPlatformProjectSetting(userSettingsPath + "render_tick_mode"));
+	config.renderTickRate = static_cast<float>(getPlatformProjectSetting(userSettingsPath + "render_tick_rate"));
+
+	// Common advanced settings
+	config.useStreamCache = static_cast<bool>(getPlatformProjectSetting(advancedSettingsPath + "use_stream_cache"));
+	config.targetAutoStreamBufferLengthMs =
+		static_cast<float>(getPlatformProjectSetting(advancedSettingsPath + "target_auto_stream_buffer_length_ms"));
+	config.ioMemorySize = static_cast<unsigned int>(getPlatformProjectSetting(advancedSettingsPath + "IO_memory_size"));
+	config.maximumPinnedBytesInCache =
+		static_cast<unsigned int>(getPlatformProjectSetting(advancedSettingsPath + "maximum_pinned_bytes_in_cache"));
+	config.debugOutOfRangeCheckEnabled =
+		static_cast<bool>(getPlatformProjectSetting(advancedSettingsPath + "debug_out_of_range_check_enabled"));
+	config.enableGameSyncPreparation =
+		static_cast<bool>(getPlatformProjectSetting(advancedSettingsPath + "enable_game_sync_preparation"));
+	config.debugOutOfRangeLimit =
+		static_cast<float>(getPlatformProjectSetting(advancedSettingsPath + "debug_out_of_range_limit"));
+	config.continuousPlaybackLookAhead =
+		static_cast<unsigned int>(getPlatformProjectSetting(advancedSettingsPath + "continuous_playback_look_ahead"));
+	config.maximumHardwareTimeoutMs =
+		static_cast<unsigned int>(getPlatformProjectSetting(advancedSettingsPath + "maximum_hardware_timeout_ms"));
+	config.monitorQueuePoolSize =
+		static_cast<unsigned int>(getPlatformProjectSetting(advancedSettingsPath + "monitor_queue_pool_size"));
+	config.usePoolAllocator =
+		static_cast<bool>(getPlatformProjectSetting(advancedSettingsPath + "memory/use_pool_allocator"));
+	config.poolBudgetMB =
+		static_cast<unsigned int>(getPlatformProjectSetting(advancedSettingsPath + "memory/pool_budget_mb"));
+	config.serverMode = static_cast<bool>(getPlatformProjectSetting(userSettingsPath + "server_mode"));
+	config.offlineRendering =
+		static_cast<bool>(getPlatformProjectSetting(advancedSettingsPath + "offline_rendering/enabled"));
+	config.offlineRenderingFrameTime =
+		static_cast<float>(getPlatformProjectSetting(advancedSettingsPath + "offline_rendering/frame_time"));
+
+	// Spatial audio settings
+	config.maxSoundPropagationDepth =
+		static_cast<unsigned int>(getPlatformProjectSetting(userSpatialAudioPath + "max_sound_propagation_depth"));
+	config.diffractionFlags =
+		static_cast<unsigned int>(getPlatformProjectSetting(userSpatialAudioPath + "diffraction_flags"));
+	config.diffractionShadowAttenuationFactor = static_cast<float>(
+		getPlatformProjectSetting(advancedSpatialAudioPath + "diffraction_shadow_attenuation_factor"));
+	config.diffractionShadowDegrees =
+		static_cast<float>(getPlatformProjectSetting(advancedSpatialAudioPath + "diffraction_shadow_degrees"));
+	config.geometryWeldTolerance =
+		static_cast<float>(getPlatformProjectSetting(advancedSpatialAudioPath + "geometry_weld_tolerance"));
+	config.geometryCommitsPerFrame =
+		static_cast<unsigned int>(getPlatformProjectSetting(advancedSpatialAudioPath + "geometry_commits_per_frame"));
+	config.occlusionRaysPerFrame =
+		static_cast<unsigned int>(getPlatformProjectSetting(advancedSpatialAudioPath + "occlusion_rays_per_frame"));
+	config.occlusionSmoothingTime =
+		static_cast<float>(getPlatformProjectSetting(advancedSpatialAudioPath + "occlusion_smoothing_time"));
+	config.occlusionPerHit =
+		static_cast<float>(getPlatformProjectSetting(advancedSpatialAudioPath + "occlusion_per_hit"));
+	config.occlusionCollisionMask =
+		static_cast<unsigned int>(getPlatformProjectSetting(advancedSpatialAudioPath + "occlusion_collision_mask"));
+	config.emitterLodFullRateRatio =
+		static_cast<float>(getPlatformProjectSetting(advancedSettingsPath + "emitter_lod/full_rate_distance_ratio"));
+	config.emitterLodReducedInterval = static_cast<unsigned int>(
+		getPlatformProjectSetting(advancedSettingsPath + "emitter_lod/reduced_update_interval"));
+	config.emitterLodResumeMargin =
+		static_cast<float>(getPlatformProjectSetting(advancedSettingsPath + "emitter_lod/resume_margin"));
+	config.emitterLodHysteresis =
+		static_cast<float>(getPlatformProjectSetting(advancedSettingsPath + "emitter_lod/hysteresis"));
+	config.emitterClusterRadius =
+		static_cast<float>(getPlatformProjectSetting(advancedSettingsPath + "emitter_clusters/cluster_radius"));
+	config.maxEmitterClusters =
+		static_cast<unsigned int>(getPlatformProjectSetting(advancedSettingsPath + "emitter_clusters/max_clusters"));
+	config.transientGameObjectPoolSize = static_cast<unsigned int>(
+		getPlatformProjectSetting(advancedSettingsPath + "transient_game_objects/pool_size"));
+	config.maxTransientGameObjects = static_cast<unsigned int>(
+		getPlatformProjectSetting(advancedSettingsPath + "transient_game_objects/max_pool_size"));
+	config.movementThreshold =
+		static_cast<float>(getPlatformProjectSetting(userSpatialAudioPath + "movement_threshold"));
+	config.numberOfPrimaryRays =
+		static_cast<unsigned int>(getPlatformProjectSetting(userSpatialAudioPath + "number_of_primary_rays"));
+	config.maxReflectionOrder =
+		static_cast<unsigned int>(getPlatformProjectSetting(userSpatialAudioPath + "max_reflection_order"));
+	config.maxPathLength = static_cast<float>(getPlatformProjectSetting(userSpatialAudioPath + "max_path_length"));
+	config.enableDiffractionOnReflections =
+		static_cast<bool>(getPlatformProjectSetting(userSpatialAudioPath + "enable_diffraction_on_reflections"));
+	config.enableDirectPathDiffraction =
+		static_cast<bool>(getPlatformProjectSetting(userSpatialAudioPath + "enable_direct_path_diffraction"));
+	config.enableTransmission =
+		static_cast<bool>(getPlatformProjectSetting(userSpatialAudioPath + "enable_transmission"));
+
+	// Communication settings
+	config.initializeSystemComms =
+		static_cast<bool>(getPlatformProjectSetting(WWISE_COMMUNICATION_SETTINGS_PATH + "initialize_system_comms"));
+	config.commandPort =
+		static_cast<unsigned int>(getPlatformProjectSetting(WWISE_COMMUNICATION_SETTINGS_PATH + "command_port"));
+	config.discoveryBroadcastPort = static_cast<unsigned int>(
+		getPlatformProjectSetting(WWISE_COMMUNICATION_SETTINGS_PATH + "discovery_broadcast_port"));
+	config.notificationPort =
+		static_cast<unsigned int>(getPlatformProjectSetting(WWISE_COMMUNICATION_SETTINGS_PATH + "notification_port"));
+	config.networkName = getPlatformProjectSetting(WWISE_COMMUNICATION_SETTINGS_PATH + "network_name");
+
+	// Platform-specific settings
+#ifdef AK_WIN
+	config.globalFocus = static_cast<bool>(getPlatformProjectSetting("wwise/windows_advanced_settings/global_focus"));
+	config.audioAPI =
+		static_cast<unsigned int>(getPlatformProjectSetting("wwise/windows_advanced_settings/audio_API"));
+#elif defined(AK_MAC_OS_X)
+
+#elif defined(AK_IOS)
+	config.audioSessionCategory =
+		static_cast<unsigned int>(getPlatformProjectSetting("wwise/ios_advanced_settings/audio_session_category"));
+	config.audioSessionCategoryOptions = static_cast<unsigned int>(
+		getPlatformProjectSetting("wwise/ios_advanced_settings/audio_session_category_options"));
+	config.audioSessionMode =
+		static_cast<unsigned int>(getPlatformProjectSetting("wwise/ios_advanced_settings/audio_session_mode"));
+#elif defined(AK_ANDROID)
+	config.audioAPI =
+		static_cast<unsigned int>(getPlatformProjectSetting("wwise/android_advanced_settings/audio_API"));
+	config.roundFrameSizeToHWSize =
+		static_cast<bool>(getPlatformProjectSetting("wwise/android_advanced_settings/round_frame_size_to_hw_size"));
+#elif defined(AK_LINUX)
+	config.audioAPI = static_cast<unsigned int>(getPlatformProjectSetting("wwise/linux_advanced_settings/audio_API"));
+#else
+#error "Platform not supported"
+#endif
+}
+
 bool Wwise::initialiseWwiseSystems()
 {
+	int64_t phaseStartUsec = OS::get_singleton()->get_ticks_usec();
+
 	AkMemSettings memSettings;
 	AK::MemoryMgr::GetDefaultSettings(memSettings);
+
+	if (config.usePoolAllocator)
+	{
+		if (CAkMemoryPoolGodot::Init(static_cast<size_t>(config.poolBudgetMB) * 1024 * 1024))
+		{
+			CAkMemoryPoolGodot::SetupMemSettings(memSettings);
+		}
+		else
+		{
+			Godot::print_warning("Failed to reserve the Wwise memory pool, falling back to the default allocator",
+								 __FUNCTION__, __FILE__, __LINE__);
+		}
+	}
+
 	if (!ERROR_CHECK(AK::MemoryMgr::Init(&memSettings), "Memory manager initialisation failed"))
 	{
 		return false;
 	}
 
+	int64_t phaseEndUsec = OS::get_singleton()->get_ticks_usec();
+	recordStartupTiming("memory_manager", phaseStartUsec, phaseEndUsec);
+	phaseStartUsec = phaseEndUsec;
+
 	AkStreamMgrSettings stmSettings;
 	AK::StreamMgr::GetDefaultSettings(stmSettings);
 	if (!AK::StreamMgr::Create(stmSettings))
@@ -1471,18 +4014,10 @@ bool Wwise::initialiseWwiseSystems()
 	AkDeviceSettings deviceSettings;
 	AK::StreamMgr::GetDefaultDeviceSettings(deviceSettings);
 
-	deviceSettings.bUseStreamCache =
-		static_cast<bool>(getPlatformProjectSetting(WWISE_COMMON_ADVANCED_SETTINGS_PATH + "use_stream_cache"));
-
-	deviceSettings.fTargetAutoStmBufferLength = static_cast<float>(
-		getPlatformProjectSetting(WWISE_COMMON_ADVANCED_SETTINGS_PATH + "target_auto_stream_buffer_length_ms"));
-
-	deviceSettings.uIOMemorySize =
-		static_cast<unsigned int>(getPlatformProjectSetting(WWISE_COMMON_ADVANCED_SETTINGS_PATH + "IO_memory_size"));
-
-	deviceSettings.uMaxCachePinnedBytes = static_cast<unsigned int>(
-		getPlatformProjectSetting(WWISE_COMMON_ADVANCED_SETTINGS_PATH + "maximum_pinned_bytes_in_cache"));
-
+	deviceSettings.bUseStreamCache = config.useStreamCache;
+	deviceSettings.fTargetAutoStmBufferLength = config.targetAutoStreamBufferLengthMs;
+	deviceSettings.uIOMemorySize = config.ioMemorySize;
+	deviceSettings.uMaxCachePinnedBytes = config.maximumPinnedBytesInCache;
 	deviceSettings.uSchedulerTypeFlags = AK_SCHEDULER_BLOCKING;
 
 	if (!ERROR_CHECK(lowLevelIO.Init(deviceSettings), "Initialising Low level IO failed"))
@@ -1490,6 +4025,31 @@ bool Wwise::initialiseWwiseSystems()
 		return false;
 	}
 
+#ifdef AK_WIN
+	String platformBanksSuffix = "/Windows";
+#elif defined(AK_MAC_OS_X)
+	String platformBanksSuffix = "/Mac";
+#elif defined(AK_IOS)
+	String platformBanksSuffix = "/iOS";
+#elif defined(AK_ANDROID)
+	String platformBanksSuffix = "/Android";
+#elif defined(AK_LINUX)
+	String platformBanksSuffix = "/Linux";
+#else
+#error "Platform not supported"
+#endif
+
+	// The bank paths only depend on the low level IO, set them now so the Init bank can be loaded as soon as the
+	// sound engine is up
+	bool setBasePathResult = setBasePath(config.basePath + platformBanksSuffix + "/");
+	AKASSERT(setBasePathResult);
+
+	setCurrentLanguage(config.startupLanguage);
+
+	phaseEndUsec = OS::get_singleton()->get_ticks_usec();
+	recordStartupTiming("stream_manager", phaseStartUsec, phaseEndUsec);
+	phaseStartUsec = phaseEndUsec;
+
 	AkInitSettings initSettings;
 	AK::SoundEngine::GetDefaultInitSettings(initSettings);
 
@@ -1497,68 +4057,42 @@ bool Wwise::initialiseWwiseSystems()
 	initSettings.pfnAssertHook = WwiseAssertHook;
 #endif
 
-	initSettings.bDebugOutOfRangeCheckEnabled = static_cast<bool>(
-		getPlatformProjectSetting(WWISE_COMMON_ADVANCED_SETTINGS_PATH + "debug_out_of_range_check_enabled"));
-
-	initSettings.bEnableGameSyncPreparation = static_cast<bool>(
-		getPlatformProjectSetting(WWISE_COMMON_ADVANCED_SETTINGS_PATH + "enable_game_sync_preparation"));
-
-	initSettings.fDebugOutOfRangeLimit =
-		static_cast<float>(getPlatformProjectSetting(WWISE_COMMON_ADVANCED_SETTINGS_PATH + "debug_out_of_range_limit"));
-
-	String audioDeviceShareSet =
-		getPlatformProjectSetting(WWISE_COMMON_USER_SETTINGS_PATH + "main_output/audio_device_shareset");
+	initSettings.bDebugOutOfRangeCheckEnabled = config.debugOutOfRangeCheckEnabled;
+	initSettings.bEnableGameSyncPreparation = config.enableGameSyncPreparation;
+	initSettings.fDebugOutOfRangeLimit = config.debugOutOfRangeLimit;
+	// Offline rendering does not need a hardware device, default to the sink that discards its output
+	const String audioDeviceShareset = config.offlineRendering && config.audioDeviceShareset.empty()
+										   ? String("No_Output")
+										   : config.audioDeviceShareset;
 	initSettings.settingsMainOutput.audioDeviceShareset =
-		AK::SoundEngine::GetIDFromString(audioDeviceShareSet.alloc_c_string());
-
-	const unsigned int channelConfigType = static_cast<unsigned int>(
-		getPlatformProjectSetting(WWISE_COMMON_USER_SETTINGS_PATH + "main_output/channel_config/channel_config_type"));
+		AK::SoundEngine::GetIDFromString(audioDeviceShareset.alloc_c_string());
 
-	const unsigned int numChannels = static_cast<unsigned int>(
-		getPlatformProjectSetting(WWISE_COMMON_USER_SETTINGS_PATH + "main_output/channel_config/number_of_channels"));
-
-	if (channelConfigType == AK_ChannelConfigType_Anonymous)
+	if (config.channelConfigType == AK_ChannelConfigType_Anonymous)
 	{
-		initSettings.settingsMainOutput.channelConfig.SetAnonymous(numChannels);
+		initSettings.settingsMainOutput.channelConfig.SetAnonymous(config.numberOfChannels);
 	}
-	else if (channelConfigType == AK_ChannelConfigType_Standard)
+	else if (config.channelConfigType == AK_ChannelConfigType_Standard)
 	{
-		initSettings.settingsMainOutput.channelConfig.SetStandard(numChannels);
+		initSettings.settingsMainOutput.channelConfig.SetStandard(config.numberOfChannels);
 	}
-	else if (channelConfigType == AK_ChannelConfigType_Ambisonic)
+	else if (config.channelConfigType == AK_ChannelConfigType_Ambisonic)
 	{
-		initSettings.settingsMainOutput.channelConfig.SetAmbisonic(numChannels);
+		initSettings.settingsMainOutput.channelConfig.SetAmbisonic(config.numberOfChannels);
 	}
 	else
 	{
 		AKASSERT(false);
 	}
 
-	initSettings.settingsMainOutput.idDevice =
-		static_cast<unsigned int>(getPlatformProjectSetting(WWISE_COMMON_USER_SETTINGS_PATH + "main_output/device_id"));
-
-	initSettings.settingsMainOutput.ePanningRule = static_cast<AkPanningRule>(static_cast<unsigned int>(
-		getPlatformProjectSetting(WWISE_COMMON_USER_SETTINGS_PATH + "main_output/panning_rule")));
-
-	initSettings.uCommandQueueSize =
-		static_cast<unsigned int>(getPlatformProjectSetting(WWISE_COMMON_USER_SETTINGS_PATH + "command_queue_size"));
-
-	initSettings.uContinuousPlaybackLookAhead = static_cast<unsigned int>(
-		getPlatformProjectSetting(WWISE_COMMON_ADVANCED_SETTINGS_PATH + "continuous_playback_look_ahead"));
-
-	initSettings.uMaxHardwareTimeoutMs = static_cast<unsigned int>(
-		getPlatformProjectSetting(WWISE_COMMON_ADVANCED_SETTINGS_PATH + "maximum_hardware_timeout_ms"));
-
-	initSettings.uMaxNumPaths = static_cast<unsigned int>(
-		getPlatformProjectSetting(WWISE_COMMON_USER_SETTINGS_PATH + "maximum_number_of_positioning_paths"));
-
-	initSettings.uMonitorQueuePoolSize = static_cast<unsigned int>(
-		getPlatformProjectSetting(WWISE_COMMON_ADVANCED_SETTINGS_PATH + "monitor_queue_pool_size"));
-
-	const unsigned int numSamplesPerFrameEnum =
-		static_cast<unsigned int>(getPlatformProjectSetting(WWISE_COMMON_USER_SETTINGS_PATH + "samples_per_frame"));
+	initSettings.settingsMainOutput.idDevice = config.deviceID;
+	initSettings.settingsMainOutput.ePanningRule = static_cast<AkPanningRule>(config.panningRule);
+	initSettings.uCommandQueueSize = config.commandQueueSize;
+	initSettings.uContinuousPlaybackLookAhead = config.continuousPlaybackLookAhead;
+	initSettings.uMaxHardwareTimeoutMs = config.maximumHardwareTimeoutMs;
+	initSettings.uMaxNumPaths = config.maximumNumberOfPositioningPaths;
+	initSettings.uMonitorQueuePoolSize = config.monitorQueuePoolSize;
 
-	switch (numSamplesPerFrameEnum)
+	switch (config.samplesPerFrame)
 	{
 	case SamplesPerFrame::SAMPLES_256:
 		initSettings.uNumSamplesPerFrame = 256;
@@ -1571,6 +4105,7 @@ bool Wwise::initialiseWwiseSystems()
 		break;
 	case SamplesPerFrame::SAMPLES_2048:
 		initSettings.uNumSamplesPerFrame = 2048;
+		break;
 	default:
 		AKASSERT(false);
 		break;
@@ -1580,10 +4115,7 @@ bool Wwise::initialiseWwiseSystems()
 	AK::SoundEngine::GetDefaultPlatformInitSettings(platformInitSettings);
 
 	// Common platform settings
-	const unsigned int numRefillsInVoiceEnum = static_cast<unsigned int>(
-		getPlatformProjectSetting(WWISE_COMMON_USER_SETTINGS_PATH + "number_of_refills_in_voice"));
-
-	switch (numRefillsInVoiceEnum)
+	switch (config.numberOfRefillsInVoice)
 	{
 	case NumRefillsInVoice::REFILLS_2:
 		platformInitSettings.uNumRefillsInVoice = 2;
@@ -1596,10 +4128,7 @@ bool Wwise::initialiseWwiseSystems()
 		break;
 	}
 
-	const unsigned int sampleRateEnum =
-		static_cast<unsigned int>(getPlatformProjectSetting(WWISE_COMMON_USER_SETTINGS_PATH + "sample_rate"));
-
-	switch (sampleRateEnum)
+	switch (config.sampleRate)
 	{
 	case SampleRate::RATE_16000:
 		platformInitSettings.uSampleRate = 16000;
@@ -1623,37 +4152,20 @@ bool Wwise::initialiseWwiseSystems()
 
 	// Platform-specific settings
 #ifdef AK_WIN
-	platformInitSettings.bGlobalFocus =
-		static_cast<bool>(getPlatformProjectSetting("wwise/windows_advanced_settings/global_focus"));
-
-	platformInitSettings.eAudioAPI = static_cast<AkAudioAPI>(
-		static_cast<unsigned int>(getPlatformProjectSetting("wwise/windows_advanced_settings/audio_API")));
+	platformInitSettings.bGlobalFocus = config.globalFocus;
+	platformInitSettings.eAudioAPI = static_cast<AkAudioAPI>(config.audioAPI);
 #elif defined(AK_MAC_OS_X)
 
 #elif defined(AK_IOS)
-	const unsigned int sessionCategoryEnum =
-		static_cast<unsigned int>(getPlatformProjectSetting("wwise/ios_advanced_settings/audio_session_category"));
-
-	platformInitSettings.audioSession.eCategory = static_cast<AkAudioSessionCategory>(sessionCategoryEnum);
-
-	const unsigned int sessionCategoryFlags = static_cast<unsigned int>(
-		getPlatformProjectSetting("wwise/ios_advanced_settings/audio_session_category_options"));
-
+	platformInitSettings.audioSession.eCategory = static_cast<AkAudioSessionCategory>(config.audioSessionCategory);
 	platformInitSettings.audioSession.eCategoryOptions =
-		static_cast<AkAudioSessionCategoryOptions>(sessionCategoryEnum);
-
-	const unsigned int audioSessionModeEnum =
-		static_cast<unsigned int>(getPlatformProjectSetting("wwise/ios_advanced_settings/audio_session_mode"));
-
-	platformInitSettings.audioSession.eMode = static_cast<AkAudioSessionMode>(audioSessionModeEnum);
+		static_cast<AkAudioSessionCategoryOptions>(config.audioSessionCategoryOptions);
+	platformInitSettings.audioSession.eMode = static_cast<AkAudioSessionMode>(config.audioSessionMode);
 
 #elif defined(AK_ANDROID)
 
-	platformInitSettings.eAudioAPI = static_cast<AkAudioAPIAndroid>(
-		static_cast<unsigned int>(getPlatformProjectSetting("wwise/android_advanced_settings/audio_API")));
-
-	platformInitSettings.bRoundFrameSizeToHWSize =
-		static_cast<bool>(getPlatformProjectSetting("wwise/android_advanced_settings/round_frame_size_to_hw_size"));
+	platformInitSettings.eAudioAPI = static_cast<AkAudioAPIAndroid>(config.audioAPI);
+	platformInitSettings.bRoundFrameSizeToHWSize = config.roundFrameSizeToHWSize;
 
 	JNIEnv* env = godot::android_api->godot_android_get_env();
 
@@ -1666,8 +4178,7 @@ bool Wwise::initialiseWwiseSystems()
 
 #elif defined(AK_LINUX)
 
-	platformInitSettings.eAudioAPI = static_cast<AkAudioAPILinux>(
-		static_cast<unsigned int>(getPlatformProjectSetting("wwise/linux_advanced_settings/audio_API")));
+	platformInitSettings.eAudioAPI = static_cast<AkAudioAPILinux>(config.audioAPI);
 
 #else
 #error "Platform not supported"
@@ -1678,86 +4189,201 @@ bool Wwise::initialiseWwiseSystems()
 		return false;
 	}
 
+	numSamplesPerFrame = initSettings.uNumSamplesPerFrame;
+	sampleRate = platformInitSettings.uSampleRate;
+
+	if (config.offlineRendering)
+	{
+		offlineFrameTime = config.offlineRenderingFrameTime > 0.0f
+							   ? config.offlineRenderingFrameTime
+							   : static_cast<float>(numSamplesPerFrame) / static_cast<float>(sampleRate);
+
+		if (!ERROR_CHECK(AK::SoundEngine::SetOfflineRenderingFrameTime(offlineFrameTime),
+						 "Failed to set the offline rendering frame time") ||
+			!ERROR_CHECK(AK::SoundEngine::SetOfflineRendering(true), "Failed to enable offline rendering"))
+		{
+			return false;
+		}
+	}
+
+	phaseEndUsec = OS::get_singleton()->get_ticks_usec();
+	recordStartupTiming("sound_engine", phaseStartUsec, phaseEndUsec);
+	phaseStartUsec = phaseEndUsec;
+
 	AkMusicSettings musicInitSettings;
 	AK::MusicEngine::GetDefaultInitSettings(musicInitSettings);
 
-	musicInitSettings.fStreamingLookAheadRatio =
-		static_cast<float>(getPlatformProjectSetting(WWISE_COMMON_USER_SETTINGS_PATH + "streaming_look_ahead_ratio"));
+	musicInitSettings.fStreamingLookAheadRatio = config.streamingLookAheadRatio;
 
 	if (!ERROR_CHECK(AK::MusicEngine::Init(&musicInitSettings), "Music engine initialisation failed"))
 	{
 		return false;
 	}
 
+	phaseEndUsec = OS::get_singleton()->get_ticks_usec();
+	recordStartupTiming("music_engine", phaseStartUsec, phaseEndUsec);
+
+	// The Init bank is loaded on the bank thread while the remaining systems are brought up, _init waits for it
+	// before returning
+	if (config.loadInitBankAtStartup)
+	{
+		startInitBankLoad();
+	}
+
+	phaseStartUsec = OS::get_singleton()->get_ticks_usec();
+
 	AkSpatialAudioInitSettings spatialSettings;
 
-	spatialSettings.uMaxSoundPropagationDepth = static_cast<unsigned int>(getPlatformProjectSetting(
-		WWISE_COMMON_USER_SETTINGS_PATH + WWISE_SPATIAL_AUDIO_PATH + "max_sound_propagation_depth"));
+	spatialSettings.uMaxSoundPropagationDepth = config.maxSoundPropagationDepth;
+	spatialSettings.uDiffractionFlags = config.diffractionFlags;
+	spatialSettings.fDiffractionShadowAttenFactor = config.diffractionShadowAttenuationFactor;
+	spatialSettings.fDiffractionShadowDegrees = config.diffractionShadowDegrees;
+	spatialSettings.fMovementThreshold = config.movementThreshold;
+	spatialSettings.uNumberOfPrimaryRays = config.numberOfPrimaryRays;
+	spatialSettings.uMaxReflectionOrder = config.maxReflectionOrder;
+	spatialSettings.fMaxPathLength = config.maxPathLength;
+	spatialSettings.bEnableDiffractionOnReflection = config.enableDiffractionOnReflections;
+	spatialSettings.bEnableDirectPathDiffraction = config.enableDirectPathDiffraction;
+	spatialSettings.bEnableTransmission = config.enableTransmission;
+
+	if (!ERROR_CHECK(AK::SpatialAudio::Init(spatialSettings), "Spatial Audio initialisation failed"))
+	{
+		return false;
+	}
+
+	recordStartupTiming("spatial_audio", phaseStartUsec, OS::get_singleton()->get_ticks_usec());
+
+#ifndef AK_OPTIMIZED
+	// Comm initialisation opens the profiler sockets which can take a while, nothing else depends on it so it is done
+	// in the background and joined on shutdown
+	AkThreadProperties commThreadProperties;
+	AKPLATFORM::AkGetDefaultThreadProperties(commThreadProperties);
+	AKPLATFORM::AkCreateThread(commInitThreadRoutine, this, commThreadProperties, &commInitThread, "Wwise Comm Init");
+
+	if (!AKPLATFORM::AkIsValidThread(&commInitThread))
+	{
+		Godot::print_warning("Failed to create the comm initialisation thread, initialising comm synchronously",
+							 __FUNCTION__, __FILE__, __LINE__);
+		commInitThreadRoutine(this);
+	}
+#endif
+
+	return true;
+}
+
+#ifndef AK_OPTIMIZED
+AK_DECLARE_THREAD_ROUTINE(Wwise::commInitThreadRoutine)
+{
+	Wwise* wwise = static_cast<Wwise*>(AK_THREAD_ROUTINE_PARAMETER);
+	AKASSERT(wwise);
+
+	const int64_t startUsec = OS::get_singleton()->get_ticks_usec();
 
-	spatialSettings.uDiffractionFlags = static_cast<unsigned int>(
-		getPlatformProjectSetting(WWISE_COMMON_USER_SETTINGS_PATH + WWISE_SPATIAL_AUDIO_PATH + "diffraction_flags"));
+	AkCommSettings commSettings;
+	AK::Comm::GetDefaultInitSettings(commSettings);
 
-	spatialSettings.fDiffractionShadowAttenFactor = static_cast<float>(getPlatformProjectSetting(
-		WWISE_COMMON_ADVANCED_SETTINGS_PATH + WWISE_SPATIAL_AUDIO_PATH + "diffraction_shadow_attenuation_factor"));
+	commSettings.bInitSystemLib = wwise->config.initializeSystemComms;
+	commSettings.ports.uCommand = wwise->config.commandPort;
+	commSettings.ports.uDiscoveryBroadcast = wwise->config.discoveryBroadcastPort;
+	commSettings.ports.uNotification = wwise->config.notificationPort;
 
-	spatialSettings.fDiffractionShadowDegrees = static_cast<float>(getPlatformProjectSetting(
-		WWISE_COMMON_ADVANCED_SETTINGS_PATH + WWISE_SPATIAL_AUDIO_PATH + "diffraction_shadow_degrees"));
+	AKPLATFORM::SafeStrCpy(commSettings.szAppNetworkName, wwise->config.networkName.alloc_c_string(),
+						   AK_COMM_SETTINGS_MAX_STRING_SIZE);
 
-	spatialSettings.fMovementThreshold = static_cast<float>(
-		getPlatformProjectSetting(WWISE_COMMON_USER_SETTINGS_PATH + WWISE_SPATIAL_AUDIO_PATH + "movement_threshold"));
+	ERROR_CHECK(AK::Comm::Init(commSettings), "Comm initialisation failed");
 
-	spatialSettings.uNumberOfPrimaryRays = static_cast<unsigned int>(getPlatformProjectSetting(
-		WWISE_COMMON_USER_SETTINGS_PATH + WWISE_SPATIAL_AUDIO_PATH + "number_of_primary_rays"));
+	wwise->commInitDurationUsec = OS::get_singleton()->get_ticks_usec() - startUsec;
 
-	spatialSettings.uMaxReflectionOrder = static_cast<unsigned int>(
-		getPlatformProjectSetting(WWISE_COMMON_USER_SETTINGS_PATH + WWISE_SPATIAL_AUDIO_PATH + "max_reflection_order"));
+	AK_RETURN_THREAD_OK;
+}
+#endif
 
-	spatialSettings.fMaxPathLength = static_cast<float>(
-		getPlatformProjectSetting(WWISE_COMMON_USER_SETTINGS_PATH + WWISE_SPATIAL_AUDIO_PATH + "max_path_length"));
+bool Wwise::startInitBankLoad()
+{
+	AKASSERT(!initBankLoadPending);
 
-	spatialSettings.bEnableDiffractionOnReflection = static_cast<bool>(getPlatformProjectSetting(
-		WWISE_COMMON_USER_SETTINGS_PATH + WWISE_SPATIAL_AUDIO_PATH + "enable_diffraction_on_reflections"));
+	if (AKPLATFORM::AkCreateEvent(initBankLoadedEvent) != AK_Success)
+	{
+		// Fall back to the synchronous load
+		return loadBankID(AK::SoundEngine::GetIDFromString("Init"));
+	}
 
-	spatialSettings.bEnableDirectPathDiffraction = static_cast<bool>(getPlatformProjectSetting(
-		WWISE_COMMON_USER_SETTINGS_PATH + WWISE_SPATIAL_AUDIO_PATH + "enable_direct_path_diffraction"));
+	initBankLoadStartUsec = OS::get_singleton()->get_ticks_usec();
 
-	spatialSettings.bEnableTransmission = static_cast<bool>(
-		getPlatformProjectSetting(WWISE_COMMON_USER_SETTINGS_PATH + WWISE_SPATIAL_AUDIO_PATH + "enable_transmission"));
+	const AkBankID initBankID = AK::SoundEngine::GetIDFromString("Init");
+	const AKRESULT result = AK::SoundEngine::LoadBank(initBankID, initBankCallback, this);
 
-	if (!ERROR_CHECK(AK::SpatialAudio::Init(spatialSettings), "Spatial Audio initialisation failed"))
+	if (!ERROR_CHECK(result, "Failed to start loading the Init bank"))
 	{
+		AKPLATFORM::AkDestroyEvent(initBankLoadedEvent);
 		return false;
 	}
 
-#ifndef AK_OPTIMIZED
-	AkCommSettings commSettings;
-	AK::Comm::GetDefaultInitSettings(commSettings);
+	initBankLoadPending = true;
+	return true;
+}
 
-	commSettings.bInitSystemLib =
-		static_cast<bool>(getPlatformProjectSetting(WWISE_COMMUNICATION_SETTINGS_PATH + "initialize_system_comms"));
+bool Wwise::waitForInitBankLoad()
+{
+	if (!initBankLoadPending)
+	{
+		return true;
+	}
 
-	commSettings.ports.uCommand =
-		static_cast<unsigned int>(getPlatformProjectSetting(WWISE_COMMUNICATION_SETTINGS_PATH + "command_port"));
+	AKPLATFORM::AkWaitForEvent(initBankLoadedEvent);
+	AKPLATFORM::AkDestroyEvent(initBankLoadedEvent);
+	initBankLoadPending = false;
 
-	commSettings.ports.uDiscoveryBroadcast = static_cast<unsigned int>(
-		getPlatformProjectSetting(WWISE_COMMUNICATION_SETTINGS_PATH + "discovery_broadcast_port"));
+	recordStartupTiming("init_bank", initBankLoadStartUsec, initBankLoadEndUsec.load());
 
-	commSettings.ports.uNotification =
-		static_cast<unsigned int>(getPlatformProjectSetting(WWISE_COMMUNICATION_SETTINGS_PATH + "notification_port"));
+	return ERROR_CHECK(initBankLoadResult, "Init bank load failed");
+}
 
-	String networkName = getPlatformProjectSetting(WWISE_COMMUNICATION_SETTINGS_PATH + "network_name");
-	AKPLATFORM::SafeStrCpy(commSettings.szAppNetworkName, networkName.alloc_c_string(),
-						   AK_COMM_SETTINGS_MAX_STRING_SIZE);
+void Wwise::initBankCallback(AkUInt32 bankID, const void* inMemoryBankPtr, AKRESULT loadResult, AkMemPoolId memPoolId,
+							 void* cookie)
+{
+	Wwise* wwise = static_cast<Wwise*>(cookie);
+	AKASSERT(wwise);
 
-	ERROR_CHECK(AK::Comm::Init(commSettings), "Comm initialisation failed");
-#endif
+	wwise->initBankLoadResult = loadResult;
+	wwise->initBankLoadEndUsec = OS::get_singleton()->get_ticks_usec();
 
-	return true;
+	AKPLATFORM::AkSignalEvent(wwise->initBankLoadedEvent);
 }
 
 bool Wwise::shutdownWwiseSystems()
 {
+	if (serverMode)
+	{
+		return true;
+	}
+
+	stopRenderThread();
+	stopGeometryThread();
+	roomResolver.clear();
+	environmentManager.clear();
+	occlusionManager.clear();
+	occlusionWorlds.clear();
+	emitterLod.clear();
+	emitterClusters.clear();
+	WwiseOutputCapture::stop();
+
+	{
+		AkAutoLock<CAkLock> scopedLock(transientGameObjectLock);
+		freeTransientGameObjects.clear();
+		transientGameObjectCount = 0;
+		droppedTransientEvents = 0;
+	}
+	waitForInitBankLoad();
+
 #ifndef AK_OPTIMIZED
+	if (AKPLATFORM::AkIsValidThread(&commInitThread))
+	{
+		AKPLATFORM::AkWaitForSingleThread(&commInitThread);
+		AKPLATFORM::AkCloseThread(&commInitThread);
+		AKPLATFORM::AkClearThread(&commInitThread);
+	}
+
 	AK::Comm::Term();
 #endif
 
@@ -1784,5 +4410,10 @@ bool Wwise::shutdownWwiseSystems()
 
 	AK::MemoryMgr::Term();
 
+	if (CAkMemoryPoolGodot::IsInitialized())
+	{
+		CAkMemoryPoolGodot::Term();
+	}
+
 	return true;
-}
\ No newline at end of file
+}
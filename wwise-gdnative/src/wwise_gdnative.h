@@ -11,6 +11,10 @@
 #include <Directory.hpp>
 #include <OS.hpp>
 #include <Resource.hpp>
+#include <Mesh.hpp>
+#include <Material.hpp>
+#include <World.hpp>
+#include <PhysicsDirectSpaceState.hpp>
 
 #include <AK/SoundEngine/Common/AkSoundEngine.h>
 #include <AK/SoundEngine/Common/AkMemoryMgr.h>
@@ -25,12 +29,34 @@
 #include <AK/SpatialAudio/Common/AkSpatialAudio.h>
 #include <AK/SoundEngine/Common/AkVirtualAcoustics.h>
 #include "wwise_godot_io.h"
+#include "wwise_benchmarks.h"
+#include "wwise_capture.h"
+#include "wwise_config.h"
+#include "wwise_emitter_clusters.h"
+#include "wwise_emitter_lod.h"
+#include "wwise_geometry.h"
+#include "wwise_environments.h"
+#include "wwise_rooms.h"
+#include "wwise_memory.h"
+#include "wwise_occlusion.h"
+#include "wwise_profiler.h"
+#include "wwise_replay.h"
+#include "wwise_trace.h"
 #include "wwise_utils.h"
 
 #ifndef AK_OPTIMIZED
 #include <AK/Comm/AkCommunication.h>
 #endif
 
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <limits>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 #if defined(AK_LINUX)
 #include <memory>
 #endif
@@ -47,7 +73,9 @@ class Wwise : public Node
 
 	static void _register_methods();
 	void _init();
+	void _ready();
 	void _process(const float delta);
+	void _physics_process(const float delta);
 	void _notification(int notification);
 
 	bool setBasePath(const String basePath);
@@ -74,6 +102,8 @@ class Wwise : public Node
 	unsigned int postEventCallback(const String eventName, const unsigned int flags, const Object* gameObject);
 	unsigned int postEventID(const unsigned int eventID, const Object* gameObject);
 	unsigned int postEventIDCallback(const unsigned int eventID, const unsigned int flags, const Object* gameObject);
+	unsigned int postEventAtPosition(const unsigned int eventID, const Transform transform);
+	Dictionary getTransientGameObjectStats();
 	bool stopEvent(const int playingID, const int fadeTime, const int interpolation);
 
 	bool setSwitch(const String switchGroup, const String switchState, const Object* gameObject);
@@ -104,14 +134,53 @@ class Wwise : public Node
 									const unsigned int sendValues);
 	bool setObjectObstructionAndOcclusion(const unsigned int gameObjectID, const unsigned int listenerID,
 										  float fCalculatedObs, float fCalculatedOcc);
+	bool addEnvironmentZone(const Object* zone, const unsigned int auxBusID, const Transform transform,
+							const Vector3 extents, const int priority, const float fadeDistance);
+	bool removeEnvironmentZone(const Object* zone);
+	bool setGameObjectEnvironmentAware(const Object* gameObject, const bool enabled);
+	Array getGameObjectAuxSends(const Object* gameObject);
+	bool setGameObjectOcclusion(const Object* emitter, const Object* listener, const int priority);
+	bool removeGameObjectOcclusion(const Object* emitter);
+	float getGameObjectOcclusion(const Object* emitter);
+	bool setGameObjectMaxRadius(const Object* gameObject, const float maxRadius);
+	int getGameObjectLodTier(const Object* gameObject);
+	Dictionary getEmitterLodStats();
+	bool setClusteredEmitter(const Object* emitter, const unsigned int eventID, const Transform transform);
+	bool removeClusteredEmitter(const Object* emitter);
+	int64_t getEmitterCluster(const Object* emitter);
+	int getEmitterClusterCount();
 
-	bool setGeometry(const Array vertices, const Array triangles, const Resource* acousticTexture,
+	bool setGeometry(const PoolVector3Array vertices, const PoolIntArray triangles, const Resource* acousticTexture,
 					 const float occlusionValue, const Object* gameObject, bool enableDiffraction,
 					 bool enableDiffractionOnBoundaryEdges, const Object* associatedRoom);
+	bool setGeometryAsync(const PoolVector3Array vertices, const PoolIntArray triangles,
+						  const Resource* acousticTexture, const float occlusionValue, const Object* gameObject,
+						  bool enableDiffraction, bool enableDiffractionOnBoundaryEdges, const Object* associatedRoom);
+	bool setGeometryWithSurfaces(const PoolVector3Array vertices, const PoolIntArray triangles,
+								 const PoolIntArray triangleSurfaces, const Array acousticTextures,
+								 const float occlusionValue, const Object* gameObject, bool enableDiffraction,
+								 bool enableDiffractionOnBoundaryEdges, const Object* associatedRoom);
+	bool setGeometryFromMesh(const Mesh* mesh, const Transform transform, const Resource* acousticTexture,
+							 const Array surfaceTextures, const float occlusionValue, const Object* gameObject,
+							 bool enableDiffraction, bool enableDiffractionOnBoundaryEdges,
+							 const Object* associatedRoom);
+	bool setGeometryFromMeshAsync(const Mesh* mesh, const Transform transform, const Resource* acousticTexture,
+								  const Array surfaceTextures, const float occlusionValue, const Object* gameObject,
+								  bool enableDiffraction, bool enableDiffractionOnBoundaryEdges,
+								  const Object* associatedRoom);
+	bool setGeometryFromBaked(const PoolByteArray bakedGeometry, const Transform transform,
+							  const Resource* acousticTexture, const Array surfaceTextures, const float occlusionValue,
+							  const Object* gameObject, bool enableDiffraction, bool enableDiffractionOnBoundaryEdges,
+							  const Object* associatedRoom);
+	bool setGeometryTransform(const Object* gameObject, const Transform transform);
+	bool setGeometrySimplification(const Object* gameObject, const int targetTriangles, const float maxError);
+	Dictionary getGeometryStats(const Object* gameObject);
 	bool removeGeometry(const Object* gameObject);
 	bool registerSpatialListener(const Object* gameObject);
 	bool setRoom(const Object* gameObject, const unsigned int akAuxBusID, const String gameObjectName);
 	bool removeRoom(const Object* gameObject);
+	bool addRoomVolume(const Object* gameObject, const Transform transform, const Vector3 extents, const int priority);
+	int64_t getGameObjectRoom(const Object* gameObject);
 	bool setPortal(const Object* gameObject, const Transform transform, const Vector3 extent, const Object* frontRoom,
 				   const Object* backRoom, bool enabled, const String portalName);
 	bool removePortal(const Object* gameObject);
@@ -125,7 +194,44 @@ class Wwise : public Node
 	bool suspend(bool renderAnyway);
 	bool wakeupFromSuspend();
 
+	Dictionary getStartupTimings();
+	Dictionary getMemoryStats();
+	Dictionary getStats();
+	void resetStats();
+	void setApiProfilingEnabled(const bool enabled);
+	Array getApiReport(const int count);
+	bool startTrace(const int capacity);
+	void stopTrace();
+	bool flushTrace(const String path);
+
+	void beginCommandBatch();
+	void endCommandBatch();
+
+	Dictionary renderFrames(const int count);
+
+	bool startOutputCapture(const float seconds);
+	void stopOutputCapture();
+	PoolRealArray readCapturedFrames(const int maxFrames);
+	PoolByteArray readCapturedPCM16(const int maxFrames);
+	Dictionary getOutputCaptureInfo();
+
+	bool isServerMode();
+	Dictionary getServerGameSyncs();
+
+	void startCallRecording();
+	void stopCallRecording();
+	bool saveCallRecording(const String path);
+	Dictionary replayCallLog(const String path);
+
+#if defined(WWISE_BENCHMARKS)
+	Dictionary runBenchmarks(const Dictionary options);
+#endif
+
   private:
+#if defined(WWISE_BENCHMARKS)
+	friend class WwiseBenchmarks;
+#endif
+
 	const String GODOT_WINDOWS_SETTING_POSTFIX = ".Windows";
 	const String GODOT_MAC_OSX_SETTING_POSTFIX = ".OSX";
 	const String GODOT_IOS_SETTING_POSTFIX = ".iOS";
@@ -137,17 +243,83 @@ class Wwise : public Node
 	const String WWISE_SPATIAL_AUDIO_PATH = "spatial_audio/";
 	const String WWISE_COMMUNICATION_SETTINGS_PATH = "wwise/communication_settings/";
 
+	const String WWISE_SERVER_FEATURE = "wwise_server";
+	const String WWISE_SERVER_ARGUMENT = "--wwise-server";
+
 	static void eventCallback(AkCallbackType callbackType, AkCallbackInfo* callbackInfo);
 	void emitSignals();
 
+	static void transientEventCallback(AkCallbackType callbackType, AkCallbackInfo* callbackInfo);
+	bool registerTransientGameObject(AkGameObjectID& out_gameObjectID);
+	AkGameObjectID acquireTransientGameObject();
+
 	static void bankCallback(AkUInt32 bankID, const void* inMemoryBankPtr, AKRESULT loadResult, AkMemPoolId memPoolId);
 	void emitBankSignals();
 
 	Variant getPlatformProjectSetting(const String setting);
+	void loadConfig();
 
 	bool initialiseWwiseSystems();
 	bool shutdownWwiseSystems();
 
+	bool startInitBankLoad();
+	bool waitForInitBankLoad();
+	static void initBankCallback(AkUInt32 bankID, const void* inMemoryBankPtr, AKRESULT loadResult,
+								 AkMemPoolId memPoolId, void* cookie);
+
+#ifndef AK_OPTIMIZED
+	static AK_DECLARE_THREAD_ROUTINE(commInitThreadRoutine);
+#endif
+
+	void recordStartupTiming(const String phase, const int64_t startTicksUsec, const int64_t endTicksUsec);
+
+	bool isServerModeRequested();
+	void setServerGameSync(Dictionary& gameSyncs, const Object* gameObject, const Variant key, const Variant value);
+	Variant getServerGameSync(const Dictionary& gameSyncs, const Object* gameObject, const Variant key,
+							  const Variant defaultValue);
+	void removeServerGameSyncs(const Object* gameObject);
+
+	bool submitMeshGeometry(const Mesh* mesh, const Transform& transform, const Resource* acousticTexture,
+							const Array& surfaceTextures, const float occlusionValue, const Object* gameObject,
+							bool enableDiffraction, bool enableDiffractionOnBoundaryEdges, const Object* associatedRoom,
+							const bool async);
+	bool submitGeometry(const PoolVector3Array& vertices, const PoolIntArray& triangles,
+						const std::vector<AkSurfIdx>& triangleSurfaces, const int surfaceCount,
+						const Transform& transform, const Resource* acousticTexture, const Array& surfaceTextures,
+						const float occlusionValue, const Object* gameObject, bool enableDiffraction,
+						bool enableDiffractionOnBoundaryEdges, const Object* associatedRoom, const bool async);
+	void prepareGeometry(WwiseCachedGeometry& geometry, const Transform& transform, const Resource* acousticTexture,
+						 const Array& surfaceTextures, const float occlusionValue, bool enableDiffraction,
+						 bool enableDiffractionOnBoundaryEdges, const Object* associatedRoom);
+	bool commitGeometry(WwiseGeometryJob& job);
+	bool cacheGeometry(const AkGeometrySetID geometrySetID, WwiseCachedGeometry& geometry);
+	bool uploadGeometry(const AkGeometrySetID geometrySetID, WwiseCachedGeometry& geometry);
+	void flushGeometryTransforms();
+	void processFrame();
+	void resolveRooms();
+	void sendGameObjectRoom(const AkGameObjectID gameObjectID, const uint64_t roomID);
+	void updateEnvironments();
+	void updateOcclusion(const float delta);
+	void updateEmitterLod();
+	void updateEmitterClusters();
+	AKRESULT setSoundEnginePosition(const AkGameObjectID gameObjectID, const Transform& transform);
+	WwiseOcclusionManager::RayResult castOcclusionRay(const uint64_t emitterID, const Vector3& from, const Vector3& to,
+													  const unsigned int maxRays);
+
+	bool queueGeometryJob(WwiseGeometryJob& job);
+	void cancelGeometryJob(const AkGeometrySetID geometrySetID);
+	void commitGeometryJobs();
+	bool startGeometryThread();
+	void stopGeometryThread();
+	static AK_DECLARE_THREAD_ROUTINE(geometryThreadRoutine);
+
+	void renderAudio();
+	void noteCommandSubmission();
+
+	bool startRenderThread();
+	void stopRenderThread();
+	static AK_DECLARE_THREAD_ROUTINE(renderThreadRoutine);
+
 	static CAkLock signalDataLock;
 	static std::unique_ptr<Array> signalDataArray;
 	static std::unique_ptr<Array> signalBankDataArray;
@@ -155,6 +327,99 @@ class Wwise : public Node
 
 	ProjectSettings* projectSettings;
 	CAkFileIOHandlerGodot lowLevelIO;
+
+	WwiseConfig config;
+	String platformSettingPostfix;
+	Dictionary startupTimings;
+
+	bool initBankLoadPending = false;
+	AkEvent initBankLoadedEvent;
+	AKRESULT initBankLoadResult = AK_Success;
+	int64_t initBankLoadStartUsec = 0;
+	std::atomic<int64_t> initBankLoadEndUsec{0};
+
+	bool serverMode = false;
+	Dictionary serverStates;
+	// Per game object ID, AK_INVALID_GAME_OBJECT holds the global values
+	Dictionary serverSwitches;
+	Dictionary serverRTPCs;
+
+	AkUInt32 numSamplesPerFrame = 0;
+	AkUInt32 sampleRate = 0;
+	float offlineFrameTime = 0.0f;
+
+	// Welded geometry per set ID, kept so set_geometry_transform only re-transforms the vertices. Also used by
+	// RenderAudio on the render thread.
+	CAkLock geometryLock;
+	std::unordered_map<AkGeometrySetID, WwiseCachedGeometry> geometryCache;
+	std::vector<AkGeometrySetID> pendingGeometryTransforms;
+	// Applied by set_geometry and set_geometry_from_mesh, baked geometry is simplified when it is baked
+	std::unordered_map<AkGeometrySetID, WwiseGeometrySimplification> geometrySimplifications;
+	std::vector<AkVertex> transformedVertices;
+
+	// Jobs queued by set_geometry_async for the geometry thread, and the built ones waiting for commitGeometryJobs
+	CAkLock geometryJobLock;
+	std::deque<WwiseGeometryJob> geometryJobs;
+	std::deque<WwiseGeometryJob> builtGeometryJobs;
+	std::unordered_map<AkGeometrySetID, uint64_t> geometryJobTickets;
+	uint64_t nextGeometryJobTicket = 0;
+	AkEvent geometryJobEvent;
+	AkThread geometryThread;
+	std::atomic<bool> geometryThreadRunning{false};
+
+	// Room of each positioned game object from the room volumes, resolved once per frame on the main thread
+	WwiseRoomResolver roomResolver;
+	std::vector<WwiseRoomResolver::RoomChange> roomChanges;
+
+	// Aux sends of environment aware game objects from the environment zones, updated right after the rooms
+	WwiseEnvironmentManager environmentManager;
+	std::vector<WwiseEnvironmentManager::SendChange> environmentChanges;
+
+	// Emitters whose obstruction and occlusion come from rays towards their listener, cast in _physics_process where
+	// the direct space state of their World can be used
+	WwiseOcclusionManager occlusionManager;
+	std::vector<WwiseOcclusionManager::OcclusionChange> occlusionChanges;
+	std::unordered_map<uint64_t, Ref<World>> occlusionWorlds;
+	Array occlusionExclusions;
+
+	// Last transform and update tier of emitters with a max attenuation radius, see set_game_obj_max_radius
+	WwiseEmitterLod emitterLod;
+	std::vector<uint64_t> lodDueEmitters;
+	std::vector<WwiseEmitterLod::ActivityChange> lodActivityChanges;
+
+	// Emitters of the same event grouped into cluster game objects, each played once with one position per emitter
+	WwiseEmitterClusters emitterClusters;
+	std::vector<WwiseEmitterClusters::ClusterChange> clusterChanges;
+	std::vector<Transform> clusterTransforms;
+	std::vector<AkSoundPosition> clusterPositions;
+
+	// Pre-registered game objects for post_event_at_position, handed back by the audio thread on AK_EndOfEvent. The
+	// free list is reserved for the max pool size up front so the audio thread never reallocates it.
+	static const AkGameObjectID TRANSIENT_GAME_OBJECT_ID_BASE = 0x7E00000000000000ull;
+	CAkLock transientGameObjectLock;
+	std::vector<AkGameObjectID> freeTransientGameObjects;
+	AkGameObjectID transientGameObjectCount = 0;
+	AkGameObjectID maxTransientGameObjects = 0;
+	uint64_t droppedTransientEvents = 0;
+
+	CAkLock statsLock;
+	WwiseTimingStats renderAudioTiming;
+	WwiseTimingStats commandLatencyTiming;
+	std::atomic<int64_t> firstCommandUsec{0};
+
+	// Held while RenderAudio runs on the render thread. begin/end_command_batch only flip commandBatchOpen under it,
+	// the render thread holds its tick back while a batch is open so a group of commands lands in the same audio
+	// frame, never for longer than one tick period.
+	CAkLock commandSubmissionLock;
+	bool commandBatchOpen = false;
+	std::chrono::steady_clock::time_point commandBatchStart;
+	AkThread renderThread;
+	std::atomic<bool> renderThreadRunning{false};
+
+#ifndef AK_OPTIMIZED
+	AkThread commInitThread;
+	std::atomic<int64_t> commInitDurationUsec{-1};
+#endif
 };
 } // namespace godot
 
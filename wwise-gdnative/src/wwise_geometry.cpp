@@ -0,0 +1,822 @@
+#include "wwise_geometry.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <queue>
+#include <unordered_map>
+
+using namespace godot;
+
+namespace
+{
+// Keeps open and surface boundary edges in place unless collapsing them is nearly free
+const double BOUNDARY_WEIGHT = 1000.0;
+// Orders collapses of equal error shortest first, without it a flat region keeps collapsing into the same vertex and
+// its triangle fan grows with every step
+const double EDGE_LENGTH_WEIGHT = 1e-6;
+// Collapses that turn a neighbouring triangle more than about 80 degrees are rejected as flips
+const double FLIP_COS_THRESHOLD = 0.2;
+
+struct Point
+{
+	double x, y, z;
+};
+
+Point operator-(const Point& a, const Point& b)
+{
+	return {a.x - b.x, a.y - b.y, a.z - b.z};
+}
+
+Point cross(const Point& a, const Point& b)
+{
+	return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+}
+
+double dot(const Point& a, const Point& b)
+{
+	return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+// Symmetric 4x4 matrix summing the squared distances to a set of planes
+struct Quadric
+{
+	double a2 = 0, ab = 0, ac = 0, ad = 0, b2 = 0, bc = 0, bd = 0, c2 = 0, cd = 0, d2 = 0;
+
+	void addPlane(const Point& normal, const double distance, const double weight)
+	{
+		a2 += weight * normal.x * normal.x;
+		ab += weight * normal.x * normal.y;
+		ac += weight * normal.x * normal.z;
+		ad += weight * normal.x * distance;
+		b2 += weight * normal.y * normal.y;
+		bc += weight * normal.y * normal.z;
+		bd += weight * normal.y * distance;
+		c2 += weight * normal.z * normal.z;
+		cd += weight * normal.z * distance;
+		d2 += weight * distance * distance;
+	}
+
+	void add(const Quadric& other)
+	{
+		a2 += other.a2;
+		ab += other.ab;
+		ac += other.ac;
+		ad += other.ad;
+		b2 += other.b2;
+		bc += other.bc;
+		bd += other.bd;
+		c2 += other.c2;
+		cd += other.cd;
+		d2 += other.d2;
+	}
+
+	double evaluate(const Point& p) const
+	{
+		return a2 * p.x * p.x + 2 * ab * p.x * p.y + 2 * ac * p.x * p.z + 2 * ad * p.x + b2 * p.y * p.y +
+			   2 * bc * p.y * p.z + 2 * bd * p.y + c2 * p.z * p.z + 2 * cd * p.z + d2;
+	}
+
+	// Position minimizing the error, fails when the planes do not pin down a single point
+	bool solve(Point& out_point) const
+	{
+		const double det = a2 * (b2 * c2 - bc * bc) - ab * (ab * c2 - bc * ac) + ac * (ab * bc - b2 * ac);
+
+		if (std::abs(det) < 1e-12)
+		{
+			return false;
+		}
+
+		const double inverseDet = 1.0 / det;
+		out_point.x = -inverseDet * (ad * (b2 * c2 - bc * bc) - ab * (bd * c2 - bc * cd) + ac * (bd * bc - b2 * cd));
+		out_point.y = -inverseDet * (a2 * (bd * c2 - cd * bc) - ad * (ab * c2 - bc * ac) + ac * (ab * cd - bd * ac));
+		out_point.z = -inverseDet * (a2 * (b2 * cd - bc * bd) - ab * (ab * cd - bd * ac) + ad * (ab * bc - b2 * ac));
+		return true;
+	}
+};
+
+struct Collapse
+{
+	double priority;
+	double cost;
+	int32_t from;
+	int32_t to;
+	uint32_t fromVersion;
+	uint32_t toVersion;
+	Point position;
+
+	bool operator<(const Collapse& other) const
+	{
+		// Inverted so the priority queue pops the cheapest collapse first
+		return priority > other.priority;
+	}
+};
+} // namespace
+
+bool WwiseGeometryBuilder::gatherMesh(const Mesh* mesh, PoolVector3Array& out_vertices, PoolIntArray& out_triangles,
+									  std::vector<AkSurfIdx>& out_triangleSurfaces)
+{
+	const ArrayMesh* arrayMesh = Object::cast_to<ArrayMesh>(mesh);
+	const int surfaceCount = static_cast<int>(mesh->get_surface_count());
+
+	std::vector<PoolVector3Array> surfaceVertices;
+	std::vector<PoolIntArray> surfaceIndices;
+	std::vector<AkSurfIdx> surfaceIDs;
+	int vertexCount = 0;
+	int indexCount = 0;
+
+	for (int surface = 0; surface < surfaceCount; ++surface)
+	{
+		// Primitive meshes only have triangle surfaces and do not expose their primitive type
+		if (arrayMesh && arrayMesh->surface_get_primitive_type(surface) != Mesh::PRIMITIVE_TRIANGLES)
+		{
+			continue;
+		}
+
+		const Array arrays = mesh->surface_get_arrays(surface);
+		const PoolVector3Array vertices = arrays[Mesh::ARRAY_VERTEX];
+		const PoolIntArray indices = arrays[Mesh::ARRAY_INDEX];
+
+		surfaceVertices.push_back(vertices);
+		surfaceIndices.push_back(indices);
+		surfaceIDs.push_back(static_cast<AkSurfIdx>(surface));
+		vertexCount += vertices.size();
+		indexCount += indices.size() > 0 ? indices.size() : vertices.size();
+	}
+
+	out_vertices.resize(vertexCount);
+	out_triangles.resize(indexCount);
+	out_triangleSurfaces.clear();
+	out_triangleSurfaces.reserve(indexCount / 3);
+
+	PoolVector3Array::Write verticesWrite = out_vertices.write();
+	PoolIntArray::Write trianglesWrite = out_triangles.write();
+	Vector3* outVertex = verticesWrite.ptr();
+	int* outIndex = trianglesWrite.ptr();
+
+	int baseVertex = 0;
+
+	for (size_t surface = 0; surface < surfaceVertices.size(); ++surface)
+	{
+		const int surfaceVertexCount = surfaceVertices[surface].size();
+		const int surfaceIndexCount = surfaceIndices[surface].size();
+
+		{
+			const PoolVector3Array::Read verticesRead = surfaceVertices[surface].read();
+			std::copy(verticesRead.ptr(), verticesRead.ptr() + surfaceVertexCount, outVertex);
+			outVertex += surfaceVertexCount;
+		}
+
+		if (surfaceIndexCount > 0)
+		{
+			const PoolIntArray::Read indicesRead = surfaceIndices[surface].read();
+			const int* indices = indicesRead.ptr();
+
+			for (int i = 0; i < surfaceIndexCount; ++i)
+			{
+				*outIndex++ = baseVertex + indices[i];
+			}
+		}
+		else
+		{
+			for (int i = 0; i < surfaceVertexCount; ++i)
+			{
+				*outIndex++ = baseVertex + i;
+			}
+		}
+
+		const int surfaceTriangleCount = (surfaceIndexCount > 0 ? surfaceIndexCount : surfaceVertexCount) / 3;
+		out_triangleSurfaces.insert(out_triangleSurfaces.end(), surfaceTriangleCount, surfaceIDs[surface]);
+
+		baseVertex += surfaceVertexCount;
+	}
+
+	return indexCount > 0;
+}
+
+void WwiseGeometryBuilder::weld(const PoolVector3Array& vertices, const PoolIntArray& triangles,
+								const float tolerance, const std::vector<AkSurfIdx>& triangleSurfaces,
+								WwiseGeometryData& out_geometry)
+{
+	out_geometry = WwiseGeometryData();
+
+	const int vertexCount = vertices.size();
+	const int triangleCount = triangles.size() / 3;
+	const float inverseTolerance = tolerance > 0.0f ? 1.0f / tolerance : 0.0f;
+
+	// Open addressing table of indices into the welded vertices, kept under half full so probes stay short
+	size_t tableSize = 16;
+
+	while (tableSize < static_cast<size_t>(vertexCount) * 2)
+	{
+		tableSize *= 2;
+	}
+
+	const size_t tableMask = tableSize - 1;
+	std::vector<int32_t> table(tableSize, -1);
+	std::vector<VertexKey> keys;
+	std::vector<int32_t> remap(vertexCount);
+
+	keys.reserve(vertexCount);
+	out_geometry.vertices.reserve(vertexCount);
+
+	{
+		const PoolVector3Array::Read verticesRead = vertices.read();
+		const Vector3* vertexData = verticesRead.ptr();
+
+		for (int v = 0; v < vertexCount; ++v)
+		{
+			const VertexKey key = makeKey(vertexData[v], inverseTolerance);
+			size_t slot = static_cast<size_t>(hashKey(key)) & tableMask;
+
+			while (table[slot] >= 0 && !(keys[table[slot]] == key))
+			{
+				slot = (slot + 1) & tableMask;
+			}
+
+			if (table[slot] < 0)
+			{
+				table[slot] = static_cast<int32_t>(keys.size());
+				keys.push_back(key);
+
+				AkVertex vertex;
+				vertex.X = vertexData[v].x;
+				vertex.Y = vertexData[v].y;
+				vertex.Z = vertexData[v].z;
+				out_geometry.vertices.push_back(vertex);
+			}
+
+			remap[v] = table[slot];
+		}
+	}
+
+	out_geometry.sourceTriangles = triangleCount;
+	out_geometry.weldedVertices = vertexCount - static_cast<int>(out_geometry.vertices.size());
+	out_geometry.weldedTriangles.reserve(triangleCount);
+
+	{
+		const PoolIntArray::Read trianglesRead = triangles.read();
+		const int* indices = trianglesRead.ptr();
+
+		for (int i = 0; i < triangleCount; ++i)
+		{
+			const int index0 = indices[3 * i + 0];
+			const int index1 = indices[3 * i + 1];
+			const int index2 = indices[3 * i + 2];
+
+			if (index0 < 0 || index0 >= vertexCount || index1 < 0 || index1 >= vertexCount || index2 < 0 ||
+				index2 >= vertexCount)
+			{
+				++out_geometry.invalidTriangles;
+				continue;
+			}
+
+			const int32_t point0 = remap[index0];
+			const int32_t point1 = remap[index1];
+			const int32_t point2 = remap[index2];
+
+			if (point0 == point1 || point0 == point2 || point1 == point2)
+			{
+				++out_geometry.degenerateTriangles;
+				continue;
+			}
+
+			WwiseWeldedTriangle triangle;
+			triangle.point0 = point0;
+			triangle.point1 = point1;
+			triangle.point2 = point2;
+			triangle.surface = static_cast<size_t>(i) < triangleSurfaces.size() ? triangleSurfaces[i] : 0;
+
+			out_geometry.weldedTriangles.push_back(triangle);
+		}
+	}
+}
+
+void WwiseGeometryBuilder::simplify(WwiseGeometryData& geometry, const WwiseGeometrySimplification& simplification)
+{
+	const size_t targetTriangles = static_cast<size_t>(std::max(simplification.targetTriangles, 0));
+	const double maxCost = simplification.maxError > 0.0f
+							   ? static_cast<double>(simplification.maxError) * simplification.maxError
+							   : std::numeric_limits<double>::max();
+
+	if ((targetTriangles == 0 && simplification.maxError <= 0.0f) ||
+		geometry.weldedTriangles.size() <= targetTriangles)
+	{
+		return;
+	}
+
+	const size_t vertexCount = geometry.vertices.size();
+	std::vector<WwiseWeldedTriangle>& triangles = geometry.weldedTriangles;
+
+	std::vector<Point> positions(vertexCount);
+	std::vector<Quadric> quadrics(vertexCount);
+	std::vector<uint32_t> versions(vertexCount, 0);
+	std::vector<bool> removedVertices(vertexCount, false);
+	std::vector<bool> removedTriangles(triangles.size(), false);
+	std::vector<std::vector<int32_t>> vertexTriangles(vertexCount);
+
+	for (size_t v = 0; v < vertexCount; ++v)
+	{
+		positions[v] = {geometry.vertices[v].X, geometry.vertices[v].Y, geometry.vertices[v].Z};
+	}
+
+	const auto trianglePoint = [&triangles](const size_t t, const int corner) -> int32_t {
+		return corner == 0 ? triangles[t].point0 : (corner == 1 ? triangles[t].point1 : triangles[t].point2);
+	};
+
+	const auto triangleNormal = [&positions](const int32_t p0, const int32_t p1, const int32_t p2) -> Point {
+		return cross(positions[p1] - positions[p0], positions[p2] - positions[p0]);
+	};
+
+	// Edge key to the first triangle using it, or -1 once a second triangle of the same surface shares it
+	std::unordered_map<uint64_t, int32_t> edgeOwners;
+
+	const auto edgeKey = [](const int32_t a, const int32_t b) -> uint64_t {
+		return (static_cast<uint64_t>(std::min(a, b)) << 32) | static_cast<uint32_t>(std::max(a, b));
+	};
+
+	for (size_t t = 0; t < triangles.size(); ++t)
+	{
+		Point normal = triangleNormal(triangles[t].point0, triangles[t].point1, triangles[t].point2);
+		const double length = std::sqrt(dot(normal, normal));
+
+		if (length > 0.0)
+		{
+			normal = {normal.x / length, normal.y / length, normal.z / length};
+		}
+
+		for (int corner = 0; corner < 3; ++corner)
+		{
+			const int32_t point = trianglePoint(t, corner);
+			quadrics[point].addPlane(normal, -dot(normal, positions[point]), 1.0);
+			vertexTriangles[point].push_back(static_cast<int32_t>(t));
+
+			const uint64_t key = edgeKey(point, trianglePoint(t, (corner + 1) % 3));
+			auto owner = edgeOwners.find(key);
+
+			if (owner == edgeOwners.end())
+			{
+				edgeOwners[key] = static_cast<int32_t>(t);
+			}
+			else if (owner->second >= 0 && triangles[owner->second].surface == triangles[t].surface)
+			{
+				owner->second = -1;
+			}
+		}
+	}
+
+	// Edges still owned by a single triangle are open or separate two surfaces, a plane through the edge and
+	// perpendicular to the triangle keeps collapses from pulling them inwards
+	for (const auto& owner : edgeOwners)
+	{
+		if (owner.second < 0)
+		{
+			continue;
+		}
+
+		const int32_t a = static_cast<int32_t>(owner.first >> 32);
+		const int32_t b = static_cast<int32_t>(owner.first & 0xFFFFFFFF);
+		const WwiseWeldedTriangle& triangle = triangles[owner.second];
+		const Point normal = triangleNormal(triangle.point0, triangle.point1, triangle.point2);
+		Point edgeNormal = cross(positions[b] - positions[a], normal);
+		const double length = std::sqrt(dot(edgeNormal, edgeNormal));
+
+		if (length <= 0.0)
+		{
+			continue;
+		}
+
+		edgeNormal = {edgeNormal.x / length, edgeNormal.y / length, edgeNormal.z / length};
+		const double distance = -dot(edgeNormal, positions[a]);
+		quadrics[a].addPlane(edgeNormal, distance, BOUNDARY_WEIGHT);
+		quadrics[b].addPlane(edgeNormal, distance, BOUNDARY_WEIGHT);
+	}
+
+	const auto makeCollapse = [&](const int32_t from, const int32_t to) -> Collapse {
+		Quadric quadric = quadrics[from];
+		quadric.add(quadrics[to]);
+
+		Collapse collapse;
+		collapse.from = from;
+		collapse.to = to;
+		collapse.fromVersion = versions[from];
+		collapse.toVersion = versions[to];
+		collapse.position = positions[to];
+		collapse.cost = quadric.evaluate(positions[to]);
+
+		const Point& a = positions[from];
+		const Point& b = positions[to];
+		const Point midpoint = {(a.x + b.x) * 0.5, (a.y + b.y) * 0.5, (a.z + b.z) * 0.5};
+		Point candidates[3] = {positions[from], midpoint, midpoint};
+		const int candidateCount = quadric.solve(candidates[2]) ? 3 : 2;
+
+		for (int c = 0; c < candidateCount; ++c)
+		{
+			const double cost = quadric.evaluate(candidates[c]);
+
+			if (cost < collapse.cost)
+			{
+				collapse.cost = cost;
+				collapse.position = candidates[c];
+			}
+		}
+
+		const Point edge = positions[to] - positions[from];
+		collapse.cost = std::max(collapse.cost, 0.0);
+		collapse.priority = collapse.cost + EDGE_LENGTH_WEIGHT * dot(edge, edge);
+		return collapse;
+	};
+
+	std::priority_queue<Collapse> collapses;
+
+	for (size_t t = 0; t < triangles.size(); ++t)
+	{
+		for (int corner = 0; corner < 3; ++corner)
+		{
+			const int32_t a = trianglePoint(t, corner);
+			const int32_t b = trianglePoint(t, (corner + 1) % 3);
+
+			// Shared edges are seen once from each side, only one direction is queued
+			if (a < b || edgeOwners[edgeKey(a, b)] >= 0)
+			{
+				collapses.push(makeCollapse(a, b));
+			}
+		}
+	}
+
+	size_t triangleCount = triangles.size();
+	std::vector<int32_t> neighbours;
+
+	while (!collapses.empty() && triangleCount > targetTriangles)
+	{
+		const Collapse collapse = collapses.top();
+		collapses.pop();
+
+		const int32_t from = collapse.from;
+		const int32_t to = collapse.to;
+
+		// Queued before one of its vertices moved or was merged, a fresh entry was pushed since
+		if (removedVertices[from] || removedVertices[to] || versions[from] != collapse.fromVersion ||
+			versions[to] != collapse.toVersion)
+		{
+			continue;
+		}
+
+		if (collapse.cost > maxCost)
+		{
+			continue;
+		}
+
+		// Reject the collapse when a surviving triangle would flip or collapse to a line
+		bool flips = false;
+
+		for (const int32_t moved : {from, to})
+		{
+			for (const int32_t t : vertexTriangles[moved])
+			{
+				if (removedTriangles[t])
+				{
+					continue;
+				}
+
+				int32_t points[3] = {triangles[t].point0, triangles[t].point1, triangles[t].point2};
+
+				if ((points[0] == from || points[1] == from || points[2] == from) &&
+					(points[0] == to || points[1] == to || points[2] == to))
+				{
+					continue;
+				}
+
+				const Point before = triangleNormal(points[0], points[1], points[2]);
+				Point corners[3] = {positions[points[0]], positions[points[1]], positions[points[2]]};
+
+				for (int corner = 0; corner < 3; ++corner)
+				{
+					if (points[corner] == moved)
+					{
+						corners[corner] = collapse.position;
+					}
+				}
+
+				const Point after = cross(corners[1] - corners[0], corners[2] - corners[0]);
+				const double lengths = std::sqrt(dot(before, before) * dot(after, after));
+
+				if (lengths <= 0.0 || dot(before, after) < FLIP_COS_THRESHOLD * lengths)
+				{
+					flips = true;
+					break;
+				}
+			}
+
+			if (flips)
+			{
+				break;
+			}
+		}
+
+		if (flips)
+		{
+			continue;
+		}
+
+		for (const int32_t t : vertexTriangles[from])
+		{
+			if (removedTriangles[t])
+			{
+				continue;
+			}
+
+			WwiseWeldedTriangle& triangle = triangles[t];
+
+			if (triangle.point0 == to || triangle.point1 == to || triangle.point2 == to)
+			{
+				removedTriangles[t] = true;
+				--triangleCount;
+				continue;
+			}
+
+			triangle.point0 = triangle.point0 == from ? to : triangle.point0;
+			triangle.point1 = triangle.point1 == from ? to : triangle.point1;
+			triangle.point2 = triangle.point2 == from ? to : triangle.point2;
+			vertexTriangles[to].push_back(t);
+		}
+
+		removedVertices[from] = true;
+		vertexTriangles[from].clear();
+		positions[to] = collapse.position;
+		quadrics[to].add(quadrics[from]);
+		++versions[to];
+
+		// Drop the removed triangles from the merged vertex and queue its edges again with their new cost
+		std::vector<int32_t>& toTriangles = vertexTriangles[to];
+		toTriangles.erase(std::remove_if(toTriangles.begin(), toTriangles.end(),
+										 [&removedTriangles](const int32_t t) { return removedTriangles[t]; }),
+						  toTriangles.end());
+
+		neighbours.clear();
+
+		for (const int32_t t : toTriangles)
+		{
+			for (int corner = 0; corner < 3; ++corner)
+			{
+				const int32_t point = trianglePoint(t, corner);
+
+				if (point != to)
+				{
+					neighbours.push_back(point);
+				}
+			}
+		}
+
+		std::sort(neighbours.begin(), neighbours.end());
+		neighbours.erase(std::unique(neighbours.begin(), neighbours.end()), neighbours.end());
+
+		for (const int32_t neighbour : neighbours)
+		{
+			collapses.push(makeCollapse(neighbour, to));
+		}
+	}
+
+	// Compact the surviving vertices and triangles
+	std::vector<int32_t> remap(vertexCount, -1);
+	std::vector<AkVertex> vertices;
+	std::vector<WwiseWeldedTriangle> simplifiedTriangles;
+	simplifiedTriangles.reserve(triangleCount);
+
+	for (size_t t = 0; t < triangles.size(); ++t)
+	{
+		if (removedTriangles[t])
+		{
+			continue;
+		}
+
+		WwiseWeldedTriangle triangle = triangles[t];
+		int32_t* points[3] = {&triangle.point0, &triangle.point1, &triangle.point2};
+
+		for (int32_t* point : points)
+		{
+			if (remap[*point] < 0)
+			{
+				remap[*point] = static_cast<int32_t>(vertices.size());
+
+				AkVertex vertex;
+				vertex.X = static_cast<AkReal32>(positions[*point].x);
+				vertex.Y = static_cast<AkReal32>(positions[*point].y);
+				vertex.Z = static_cast<AkReal32>(positions[*point].z);
+				vertices.push_back(vertex);
+			}
+
+			*point = remap[*point];
+		}
+
+		simplifiedTriangles.push_back(triangle);
+	}
+
+	geometry.simplifiedTriangles += static_cast<int>(triangles.size() - simplifiedTriangles.size());
+	geometry.vertices = std::move(vertices);
+	geometry.weldedTriangles = std::move(simplifiedTriangles);
+}
+
+bool WwiseGeometryBuilder::narrow(WwiseGeometryData& geometry)
+{
+	if (geometry.vertices.size() > std::numeric_limits<AkVertIdx>::max() ||
+		geometry.weldedTriangles.size() > std::numeric_limits<AkTriIdx>::max())
+	{
+		return false;
+	}
+
+	geometry.triangles.resize(geometry.weldedTriangles.size());
+
+	for (size_t t = 0; t < geometry.weldedTriangles.size(); ++t)
+	{
+		const WwiseWeldedTriangle& weldedTriangle = geometry.weldedTriangles[t];
+		AkTriangle& triangle = geometry.triangles[t];
+
+		triangle.point0 = static_cast<AkVertIdx>(weldedTriangle.point0);
+		triangle.point1 = static_cast<AkVertIdx>(weldedTriangle.point1);
+		triangle.point2 = static_cast<AkVertIdx>(weldedTriangle.point2);
+		triangle.surface = weldedTriangle.surface;
+	}
+
+	// Not needed past this point, the cached geometry only keeps the narrowed triangles
+	std::vector<WwiseWeldedTriangle>().swap(geometry.weldedTriangles);
+
+	return true;
+}
+
+bool WwiseGeometryBuilder::build(WwiseGeometryJob& job)
+{
+	WwiseGeometryData& data = job.geometry.data;
+	const int surfaceCount = data.surfaceCount;
+
+	weld(job.vertices, job.triangles, job.weldTolerance, job.triangleSurfaces, data);
+	data.surfaceCount = surfaceCount;
+
+	simplify(data, job.simplification);
+	job.built = narrow(data);
+
+	return job.built;
+}
+
+void WwiseGeometryBuilder::transformVertices(const std::vector<AkVertex>& vertices, const Transform& transform,
+											 std::vector<AkVertex>& out_vertices)
+{
+	const Vector3 row0 = transform.basis.elements[0];
+	const Vector3 row1 = transform.basis.elements[1];
+	const Vector3 row2 = transform.basis.elements[2];
+	const Vector3 origin = transform.origin;
+	const size_t vertexCount = vertices.size();
+
+	out_vertices.resize(vertexCount);
+
+	// Plain multiply-adds over the basis rows, no per-vertex calls
+	for (size_t v = 0; v < vertexCount; ++v)
+	{
+		const AkVertex& vertex = vertices[v];
+		AkVertex& outVertex = out_vertices[v];
+
+		// Seems to be flipped in Wwise otherwise
+		outVertex.X = -(row0.x * vertex.X + row0.y * vertex.Y + row0.z * vertex.Z + origin.x);
+		outVertex.Y = row1.x * vertex.X + row1.y * vertex.Y + row1.z * vertex.Z + origin.y;
+		outVertex.Z = row2.x * vertex.X + row2.y * vertex.Y + row2.z * vertex.Z + origin.z;
+	}
+}
+
+PoolByteArray WwiseGeometryBuilder::serialize(const WwiseGeometryData& geometry)
+{
+	static_assert(sizeof(AkVertex) == 3 * sizeof(float), "AkVertex is expected to be three packed floats");
+	static_assert(sizeof(AkTriangle) == 4 * sizeof(AkUInt16), "AkTriangle is expected to be four packed indices");
+
+	BakedHeader header;
+	header.magic = BAKED_MAGIC;
+	header.version = BAKED_VERSION;
+	header.vertexCount = static_cast<uint32_t>(geometry.vertices.size());
+	header.triangleCount = static_cast<uint32_t>(geometry.triangles.size());
+	header.surfaceCount = static_cast<uint32_t>(geometry.surfaceCount);
+
+	// Surfaces past the end of surfaceTextureIDs have no baked texture
+	std::vector<AkUniqueID> surfaceTextureIDs = geometry.surfaceTextureIDs;
+	surfaceTextureIDs.resize(header.surfaceCount, AK_INVALID_UNIQUE_ID);
+
+	const size_t surfacesSize = surfaceTextureIDs.size() * sizeof(AkUniqueID);
+	const size_t verticesSize = geometry.vertices.size() * sizeof(AkVertex);
+	const size_t trianglesSize = geometry.triangles.size() * sizeof(AkTriangle);
+
+	PoolByteArray bytes;
+	bytes.resize(static_cast<int>(sizeof(BakedHeader) + surfacesSize + verticesSize + trianglesSize));
+
+	PoolByteArray::Write bytesWrite = bytes.write();
+	uint8_t* out = bytesWrite.ptr();
+
+	memcpy(out, &header, sizeof(BakedHeader));
+	out += sizeof(BakedHeader);
+	memcpy(out, surfaceTextureIDs.data(), surfacesSize);
+	out += surfacesSize;
+	memcpy(out, geometry.vertices.data(), verticesSize);
+	out += verticesSize;
+	memcpy(out, geometry.triangles.data(), trianglesSize);
+
+	return bytes;
+}
+
+bool WwiseGeometryBuilder::deserialize(const PoolByteArray& bytes, WwiseGeometryData& out_geometry)
+{
+	out_geometry = WwiseGeometryData();
+
+	const size_t size = static_cast<size_t>(bytes.size());
+
+	if (size < sizeof(BakedHeader))
+	{
+		return false;
+	}
+
+	const PoolByteArray::Read bytesRead = bytes.read();
+	const uint8_t* in = bytesRead.ptr();
+
+	BakedHeader header;
+	memcpy(&header, in, sizeof(BakedHeader));
+	in += sizeof(BakedHeader);
+
+	// Counts are checked before any size is derived from them
+	if (header.magic != BAKED_MAGIC || header.version != BAKED_VERSION ||
+		header.vertexCount > std::numeric_limits<AkVertIdx>::max() ||
+		header.triangleCount > std::numeric_limits<AkTriIdx>::max() || header.surfaceCount == 0 ||
+		header.surfaceCount > std::numeric_limits<AkSurfIdx>::max())
+	{
+		return false;
+	}
+
+	const size_t surfacesSize = static_cast<size_t>(header.surfaceCount) * sizeof(AkUniqueID);
+	const size_t verticesSize = static_cast<size_t>(header.vertexCount) * sizeof(AkVertex);
+	const size_t trianglesSize = static_cast<size_t>(header.triangleCount) * sizeof(AkTriangle);
+
+	if (size != sizeof(BakedHeader) + surfacesSize + verticesSize + trianglesSize)
+	{
+		return false;
+	}
+
+	out_geometry.surfaceTextureIDs.resize(header.surfaceCount);
+	out_geometry.vertices.resize(header.vertexCount);
+	out_geometry.triangles.resize(header.triangleCount);
+
+	memcpy(out_geometry.surfaceTextureIDs.data(), in, surfacesSize);
+	in += surfacesSize;
+	memcpy(out_geometry.vertices.data(), in, verticesSize);
+	in += verticesSize;
+	memcpy(out_geometry.triangles.data(), in, trianglesSize);
+
+	for (const AkTriangle& triangle : out_geometry.triangles)
+	{
+		if (triangle.point0 >= header.vertexCount || triangle.point1 >= header.vertexCount ||
+			triangle.point2 >= header.vertexCount || triangle.surface >= header.surfaceCount)
+		{
+			out_geometry = WwiseGeometryData();
+			return false;
+		}
+	}
+
+	out_geometry.surfaceCount = static_cast<int>(header.surfaceCount);
+	out_geometry.sourceTriangles = static_cast<int>(header.triangleCount);
+
+	return true;
+}
+
+WwiseGeometryBuilder::VertexKey WwiseGeometryBuilder::makeKey(const Vector3& vertex, const float inverseTolerance)
+{
+	VertexKey key;
+
+	if (inverseTolerance > 0.0f)
+	{
+		key.x = static_cast<int64_t>(std::floor(vertex.x * inverseTolerance + 0.5f));
+		key.y = static_cast<int64_t>(std::floor(vertex.y * inverseTolerance + 0.5f));
+		key.z = static_cast<int64_t>(std::floor(vertex.z * inverseTolerance + 0.5f));
+	}
+	else
+	{
+		// Adding 0 turns -0 into +0 so both weld together
+		const float x = vertex.x + 0.0f;
+		const float y = vertex.y + 0.0f;
+		const float z = vertex.z + 0.0f;
+
+		uint32_t bits[3];
+		memcpy(&bits[0], &x, sizeof(float));
+		memcpy(&bits[1], &y, sizeof(float));
+		memcpy(&bits[2], &z, sizeof(float));
+
+		key.x = bits[0];
+		key.y = bits[1];
+		key.z = bits[2];
+	}
+
+	return key;
+}
+
+uint64_t WwiseGeometryBuilder::hashKey(const VertexKey& key)
+{
+	uint64_t hash = static_cast<uint64_t>(key.x) * 0x9E3779B97F4A7C15ull;
+	hash ^= static_cast<uint64_t>(key.y) * 0xC2B2AE3D27D4EB4Full;
+	hash ^= static_cast<uint64_t>(key.z) * 0x165667B19E3779F9ull;
+
+	return hash ^ (hash >> 29);
+}
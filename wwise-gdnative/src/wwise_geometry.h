@@ -0,0 +1,158 @@
+#ifndef WWISE_GEOMETRY_H
+#define WWISE_GEOMETRY_H
+
+#include <ArrayMesh.hpp>
+#include <Mesh.hpp>
+#include <PoolArrays.hpp>
+#include <String.hpp>
+#include <Transform.hpp>
+#include <AK/SoundEngine/Common/AkTypes.h>
+#include <AK/SpatialAudio/Common/AkSpatialAudio.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace godot
+{
+// Triangle of the welded mesh with 32-bit indices, so meshes past the limits of a Wwise geometry set can still be
+// simplified under them before being narrowed to AkTriangle
+struct WwiseWeldedTriangle
+{
+	int32_t point0;
+	int32_t point1;
+	int32_t point2;
+	AkSurfIdx surface;
+};
+
+// Welded vertices and triangles in the space they were given in, transformed when handed to
+// AK::SpatialAudio::SetGeometry
+struct WwiseGeometryData
+{
+	std::vector<AkVertex> vertices;
+	std::vector<AkTriangle> triangles;
+	// Output of weld and input of simplify, moved into triangles by narrow
+	std::vector<WwiseWeldedTriangle> weldedTriangles;
+	// Number of surfaces the triangles index into
+	int surfaceCount = 0;
+	// Acoustic texture of each surface taken from the mesh materials when baking, empty for geometry that was not
+	// baked. Used for the surfaces that are not given a texture when uploading.
+	std::vector<AkUniqueID> surfaceTextureIDs;
+
+	// Triangles given before welding, and how many of the welded ones simplify collapsed away
+	int sourceTriangles = 0;
+	int simplifiedTriangles = 0;
+	int weldedVertices = 0;
+	int degenerateTriangles = 0;
+	int invalidTriangles = 0;
+};
+
+// Per geometry set decimation limits, 0 disables a limit and both at 0 leaves the mesh untouched
+struct WwiseGeometrySimplification
+{
+	int targetTriangles = 0;
+	float maxError = 0.0f;
+};
+
+// Everything needed to upload a geometry set again when only its transform changes
+struct WwiseCachedGeometry
+{
+	WwiseGeometryData data;
+	std::vector<AkAcousticSurface> surfaces;
+	// Backs the surface names, strName is pointed at these on every upload
+	std::vector<CharString> surfaceNames;
+	AkRoomID roomID;
+	bool enableDiffraction = false;
+	bool enableDiffractionOnBoundaryEdges = false;
+
+	Transform transform;
+	bool transformPending = false;
+};
+
+// A geometry set welded and simplified on the geometry thread, see Wwise::setGeometryAsync
+struct WwiseGeometryJob
+{
+	AkGeometrySetID geometrySetID = 0;
+	// Only the latest job of a geometry set is committed, removing the set or setting it again cancels it
+	uint64_t ticket = 0;
+
+	PoolVector3Array vertices;
+	PoolIntArray triangles;
+	std::vector<AkSurfIdx> triangleSurfaces;
+	float weldTolerance = 0.0f;
+	WwiseGeometrySimplification simplification;
+
+	// Surfaces and settings are filled in when the job is queued, the welded data once it is built
+	WwiseCachedGeometry geometry;
+	bool built = false;
+};
+
+class WwiseGeometryBuilder
+{
+  public:
+	// Concatenates the triangle surfaces of a mesh, other primitive types are skipped and surfaces without an index
+	// array are indexed in order. Each triangle keeps the index of the mesh surface it came from.
+	static bool gatherMesh(const Mesh* mesh, PoolVector3Array& out_vertices, PoolIntArray& out_triangles,
+						   std::vector<AkSurfIdx>& out_triangleSurfaces);
+
+	// Welds the vertices that snap to the same point of a grid with tolerance sized cells, 0 only welds identical
+	// positions, and drops the triangles that collapse or reference missing vertices in the same pass. Triangles
+	// are put on surface 0 when triangleSurfaces is empty. The result is left in weldedTriangles, without any limit
+	// on its size.
+	static void weld(const PoolVector3Array& vertices, const PoolIntArray& triangles, const float tolerance,
+					 const std::vector<AkSurfIdx>& triangleSurfaces, WwiseGeometryData& out_geometry);
+
+	// Quadric edge collapse: repeatedly merges the pair of vertices whose merged position strays the least from the
+	// planes of their triangles, until the target triangle count is reached or the next collapse would move a vertex
+	// further than maxError from them. Coplanar regions cost nothing and merge first, open and surface boundaries are
+	// weighted so their outline is kept.
+	static void simplify(WwiseGeometryData& geometry, const WwiseGeometrySimplification& simplification);
+
+	// Moves weldedTriangles into triangles, fails when the mesh does not fit in a Wwise geometry set
+	static bool narrow(WwiseGeometryData& geometry);
+
+	// Welds, simplifies then narrows the job input into its geometry, only touches the job so it can run on any
+	// thread
+	static bool build(WwiseGeometryJob& job);
+
+	// Transforms the welded vertices into out_vertices, in the space Wwise expects
+	static void transformVertices(const std::vector<AkVertex>& vertices, const Transform& transform,
+								  std::vector<AkVertex>& out_vertices);
+
+	// Packs welded geometry into the baked format: a header, the surface table, then the vertices and triangles
+	// exactly as they are laid out in memory, so reading it back is a few copies and a bounds check
+	static PoolByteArray serialize(const WwiseGeometryData& geometry);
+	// Fails on data that is not a baked geometry set Wwise accepts, including stale or corrupt resources whose
+	// indices point outside of the vertices or surfaces
+	static bool deserialize(const PoolByteArray& bytes, WwiseGeometryData& out_geometry);
+
+  private:
+	struct BakedHeader
+	{
+		uint32_t magic;
+		uint32_t version;
+		uint32_t vertexCount;
+		uint32_t triangleCount;
+		uint32_t surfaceCount;
+	};
+
+	static const uint32_t BAKED_MAGIC = 0x42475757; // "WWGB"
+	static const uint32_t BAKED_VERSION = 2;
+
+	struct VertexKey
+	{
+		int64_t x;
+		int64_t y;
+		int64_t z;
+
+		bool operator==(const VertexKey& other) const
+		{
+			return x == other.x && y == other.y && z == other.z;
+		}
+	};
+
+	static VertexKey makeKey(const Vector3& vertex, const float inverseTolerance);
+	static uint64_t hashKey(const VertexKey& key);
+};
+} // namespace godot
+
+#endif
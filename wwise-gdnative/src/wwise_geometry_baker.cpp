@@ -0,0 +1,82 @@
+#include "wwise_geometry_baker.h"
+
+using namespace godot;
+
+void WwiseGeometryBaker::_register_methods()
+{
+	register_method("bake", &WwiseGeometryBaker::bake);
+}
+
+void WwiseGeometryBaker::_init() {}
+
+Dictionary WwiseGeometryBaker::bake(const Mesh* mesh, const float weldTolerance, const int targetTriangles,
+								   const float maxError)
+{
+	Dictionary result;
+
+	if (!mesh)
+	{
+		Godot::print_error("No mesh to bake", __FUNCTION__, __FILE__, __LINE__);
+		return result;
+	}
+
+	PoolVector3Array vertices;
+	PoolIntArray triangles;
+	std::vector<AkSurfIdx> triangleSurfaces;
+
+	if (!WwiseGeometryBuilder::gatherMesh(mesh, vertices, triangles, triangleSurfaces))
+	{
+		Godot::print_error("Mesh has no triangles to bake", __FUNCTION__, __FILE__, __LINE__);
+		return result;
+	}
+
+	WwiseGeometryData geometry;
+	WwiseGeometryBuilder::weld(vertices, triangles, weldTolerance, triangleSurfaces, geometry);
+	geometry.surfaceCount = static_cast<int>(mesh->get_surface_count());
+	geometry.surfaceTextureIDs.resize(geometry.surfaceCount, AK_INVALID_UNIQUE_ID);
+
+	// Same acoustic_texture material metadata setGeometryFromMesh falls back to, stored by ID in the surface table
+	for (int surface = 0; surface < geometry.surfaceCount; ++surface)
+	{
+		const Ref<Material> material = mesh->surface_get_material(surface);
+
+		if (!material.is_valid() || !material->has_meta("acoustic_texture"))
+		{
+			continue;
+		}
+
+		const Object* object = material->get_meta("acoustic_texture");
+		const Resource* texture = Object::cast_to<Resource>(object);
+
+		if (texture)
+		{
+			const String textureName = texture->get("name");
+			geometry.surfaceTextureIDs[surface] = AK::SoundEngine::GetIDFromString(textureName.utf8().get_data());
+		}
+	}
+
+	WwiseGeometrySimplification simplification;
+	simplification.targetTriangles = targetTriangles;
+	simplification.maxError = maxError;
+	WwiseGeometryBuilder::simplify(geometry, simplification);
+
+	// Only checked once simplified, full resolution meshes are expected to start over the limits
+	if (!WwiseGeometryBuilder::narrow(geometry))
+	{
+		Godot::print_error("Mesh has too many vertices or triangles for a Wwise geometry set, even once simplified",
+						   __FUNCTION__, __FILE__, __LINE__);
+		return result;
+	}
+
+	result["data"] = WwiseGeometryBuilder::serialize(geometry);
+	result["surfaces"] = geometry.surfaceCount;
+	result["vertices"] = static_cast<int>(geometry.vertices.size());
+	result["source_triangles"] = geometry.sourceTriangles;
+	result["triangles"] = static_cast<int>(geometry.triangles.size());
+	result["simplified_triangles"] = geometry.simplifiedTriangles;
+	result["welded_vertices"] = geometry.weldedVertices;
+	result["degenerate_triangles"] = geometry.degenerateTriangles;
+	result["invalid_triangles"] = geometry.invalidTriangles;
+
+	return result;
+}
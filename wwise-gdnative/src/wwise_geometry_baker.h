@@ -0,0 +1,29 @@
+#ifndef WWISE_GEOMETRY_BAKER_H
+#define WWISE_GEOMETRY_BAKER_H
+
+#include <Godot.hpp>
+#include <Dictionary.hpp>
+#include <Material.hpp>
+#include <Mesh.hpp>
+#include <Reference.hpp>
+#include <AK/SoundEngine/Common/AkSoundEngine.h>
+
+#include "wwise_geometry.h"
+
+namespace godot
+{
+// Editor side of geometry baking, registered as a tool class so it works without the sound engine. Welds and
+// simplifies a mesh once and returns the blob that Wwise::setGeometryFromBaked uploads as is.
+class WwiseGeometryBaker : public Reference
+{
+	GODOT_CLASS(WwiseGeometryBaker, Reference)
+
+  public:
+	static void _register_methods();
+	void _init();
+
+	Dictionary bake(const Mesh* mesh, const float weldTolerance, const int targetTriangles, const float maxError);
+};
+} // namespace godot
+
+#endif
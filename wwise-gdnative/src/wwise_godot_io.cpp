@@ -1,4 +1,5 @@
 #include <wwise_godot_io.h>
+#include <wwise_trace.h>
 
 #define BLOCKING_DEVICE_NAME AKTEXT("Blocking Device")
 
@@ -35,6 +36,9 @@ void CAkIOHookBlockingGodot::Term()
 
 AKRESULT CAkIOHookBlockingGodot::Open(const String& filePath, AkOpenMode in_eOpenMode, AkFileDesc& out_fileDesc)
 {
+	const bool tracing = WwiseTraceRecorder::isRecording();
+	const uint64_t traceStartUsec = tracing ? WwiseTraceRecorder::now() : 0;
+
 	AKRESULT result = AK_Fail;
 
 	File::ModeFlags openMode;
@@ -87,6 +91,13 @@ AKRESULT CAkIOHookBlockingGodot::Open(const String& filePath, AkOpenMode in_eOpe
 		result = AK_Success;
 	}
 
+	if (tracing)
+	{
+		WwiseTraceRecorder::recordComplete("io_open", traceStartUsec, WwiseTraceRecorder::now() - traceStartUsec,
+										   filePath.utf8().get_data(),
+										   result == AK_Success ? static_cast<int64_t>(out_fileDesc.iFileSize) : -1);
+	}
+
 	return result;
 }
 
@@ -95,6 +106,9 @@ AKRESULT CAkIOHookBlockingGodot::Read(AkFileDesc& in_fileDesc, const AkIoHeurist
 {
 	AKASSERT(out_pBuffer != nullptr && in_fileDesc.hFile != AkFileHandle(-1));
 
+	WwiseTraceRecorder::Scope traceScope("io_read");
+	traceScope.setValue(io_transferInfo.uRequestedSize);
+
 	File* const file = reinterpret_cast<File*>(in_fileDesc.hFile);
 	const int64_t fileReadPosition = file->get_position();
 	const int64_t wantedFileReadPosition = io_transferInfo.uFilePosition;
@@ -0,0 +1,293 @@
+#include <wwise_memory.h>
+
+#include <Godot.hpp>
+#include <cstdlib>
+
+using namespace godot;
+
+CAkLock CAkMemoryPoolGodot::lock;
+void* CAkMemoryPoolGodot::reservedBlock = nullptr;
+char* CAkMemoryPoolGodot::poolStart = nullptr;
+size_t CAkMemoryPoolGodot::numPages = 0;
+size_t CAkMemoryPoolGodot::searchHint = 0;
+std::vector<uint64_t> CAkMemoryPoolGodot::pageBitmap;
+
+std::atomic<size_t> CAkMemoryPoolGodot::usedBytes{0};
+std::atomic<size_t> CAkMemoryPoolGodot::peakUsedBytes{0};
+std::atomic<size_t> CAkMemoryPoolGodot::failedAllocations{0};
+
+static const char* MemoryCategoryName(AkUInt32 in_category)
+{
+	static const char* categoryNames[] = {"object",
+										  "event",
+										  "structure",
+										  "media",
+										  "game_object",
+										  "processing",
+										  "processing_plugin",
+										  "streaming",
+										  "streaming_io",
+										  "spatial_audio",
+										  "spatial_audio_geometry",
+										  "spatial_audio_paths",
+										  "game_sim",
+										  "monitor_queue",
+										  "profiler",
+										  "file_package",
+										  "sound_engine"};
+
+	if (in_category < sizeof(categoryNames) / sizeof(categoryNames[0]))
+	{
+		return categoryNames[in_category];
+	}
+
+	return nullptr;
+}
+
+bool CAkMemoryPoolGodot::Init(size_t in_budgetBytes)
+{
+	AKASSERT(!reservedBlock);
+
+	numPages = (in_budgetBytes + PAGE_SIZE - 1) / PAGE_SIZE;
+
+	if (numPages == 0)
+	{
+		return false;
+	}
+
+	// Over-allocate by one page so the start of the pool can be aligned on a page boundary
+	reservedBlock = std::malloc(numPages * PAGE_SIZE + PAGE_SIZE);
+
+	if (!reservedBlock)
+	{
+		numPages = 0;
+		return false;
+	}
+
+	const uintptr_t alignedStart =
+		(reinterpret_cast<uintptr_t>(reservedBlock) + PAGE_SIZE - 1) & ~static_cast<uintptr_t>(PAGE_SIZE - 1);
+	poolStart = reinterpret_cast<char*>(alignedStart);
+
+	pageBitmap.assign((numPages + 63) / 64, 0);
+	searchHint = 0;
+
+	usedBytes = 0;
+	peakUsedBytes = 0;
+	failedAllocations = 0;
+
+	return true;
+}
+
+void CAkMemoryPoolGodot::Term()
+{
+	AkAutoLock<CAkLock> scopedLock(lock);
+
+	std::free(reservedBlock);
+	reservedBlock = nullptr;
+	poolStart = nullptr;
+	numPages = 0;
+
+	std::vector<uint64_t>().swap(pageBitmap);
+}
+
+bool CAkMemoryPoolGodot::IsInitialized()
+{
+	return reservedBlock != nullptr;
+}
+
+void CAkMemoryPoolGodot::SetupMemSettings(AkMemSettings& io_memSettings)
+{
+	AKASSERT(IsInitialized());
+
+	io_memSettings.pfAllocVM = AllocVM;
+	io_memSettings.pfFreeVM = FreeVM;
+	io_memSettings.uMemAllocationSizeLimit = static_cast<AkUInt64>(GetBudget());
+}
+
+void* CAkMemoryPoolGodot::AllocVM(size_t in_size, size_t* out_extra)
+{
+	const size_t requestedPages = (in_size + PAGE_SIZE - 1) / PAGE_SIZE;
+
+	if (out_extra)
+	{
+		*out_extra = 0;
+	}
+
+	AkAutoLock<CAkLock> scopedLock(lock);
+
+	const size_t firstPage = FindFreeRun(requestedPages);
+
+	if (firstPage == numPages)
+	{
+		++failedAllocations;
+		return nullptr;
+	}
+
+	MarkPages(firstPage, requestedPages, true);
+	searchHint = firstPage + requestedPages;
+
+	const size_t used = usedBytes.fetch_add(requestedPages * PAGE_SIZE) + requestedPages * PAGE_SIZE;
+
+	if (used > peakUsedBytes)
+	{
+		peakUsedBytes = used;
+	}
+
+	return poolStart + firstPage * PAGE_SIZE;
+}
+
+void CAkMemoryPoolGodot::FreeVM(void* in_address, size_t in_size, size_t in_extra, size_t in_release)
+{
+	// A zero release size only asks to decommit part of a span, the pages stay reserved until the span is released
+	if (!in_address || in_release == 0)
+	{
+		return;
+	}
+
+	AkAutoLock<CAkLock> scopedLock(lock);
+
+	char* const address = static_cast<char*>(in_address) - in_extra;
+	AKASSERT(address >= poolStart && address < poolStart + numPages * PAGE_SIZE);
+
+	const size_t firstPage = static_cast<size_t>(address - poolStart) / PAGE_SIZE;
+	const size_t releasedPages = (in_release + PAGE_SIZE - 1) / PAGE_SIZE;
+
+	MarkPages(firstPage, releasedPages, false);
+
+	if (firstPage < searchHint)
+	{
+		searchHint = firstPage;
+	}
+
+	usedBytes -= releasedPages * PAGE_SIZE;
+}
+
+size_t CAkMemoryPoolGodot::GetBudget()
+{
+	return numPages * PAGE_SIZE;
+}
+
+size_t CAkMemoryPoolGodot::GetUsed()
+{
+	return usedBytes;
+}
+
+size_t CAkMemoryPoolGodot::GetPeakUsed()
+{
+	return peakUsedBytes;
+}
+
+size_t CAkMemoryPoolGodot::GetFailedAllocations()
+{
+	return failedAllocations;
+}
+
+Dictionary CAkMemoryPoolGodot::GetStats()
+{
+	Dictionary stats;
+
+	stats["pool_enabled"] = IsInitialized();
+	stats["pool_budget"] = static_cast<int64_t>(GetBudget());
+	stats["pool_used"] = static_cast<int64_t>(GetUsed());
+	stats["pool_peak_used"] = static_cast<int64_t>(GetPeakUsed());
+	stats["pool_failed_allocations"] = static_cast<int64_t>(GetFailedAllocations());
+
+	if (!AK::MemoryMgr::IsInitialized())
+	{
+		return stats;
+	}
+
+	AK::MemoryMgr::GlobalStats globalStats;
+	AK::MemoryMgr::GetGlobalStats(globalStats);
+
+	stats["total_used"] = static_cast<int64_t>(globalStats.uUsed);
+	stats["total_reserved"] = static_cast<int64_t>(globalStats.uReserved);
+	stats["total_peak_used"] = static_cast<int64_t>(globalStats.uMax);
+
+	Dictionary categories;
+
+	for (AkUInt32 category = 0; category < AkMemID_NUM; ++category)
+	{
+		AK::MemoryMgr::CategoryStats categoryStats;
+		AK::MemoryMgr::GetCategoryStats(category, categoryStats);
+
+		Dictionary categoryData;
+		categoryData["used"] = static_cast<int64_t>(categoryStats.uUsed);
+		categoryData["peak_used"] = static_cast<int64_t>(categoryStats.uPeakUsed);
+		categoryData["allocs"] = static_cast<unsigned int>(categoryStats.uAllocs);
+		categoryData["frees"] = static_cast<unsigned int>(categoryStats.uFrees);
+
+		const char* categoryName = MemoryCategoryName(category);
+		categories[categoryName ? String(categoryName) : "category_" + String::num_int64(category)] = categoryData;
+	}
+
+	stats["categories"] = categories;
+
+	return stats;
+}
+
+size_t CAkMemoryPoolGodot::FindFreeRun(size_t in_numPages)
+{
+	if (in_numPages == 0 || in_numPages > numPages)
+	{
+		return numPages;
+	}
+
+	// Next fit from the search hint, wrapping around to the start of the pool once
+	for (size_t pass = 0; pass < 2; ++pass)
+	{
+		size_t page = pass == 0 ? searchHint : 0;
+		const size_t end = pass == 0 ? numPages : searchHint + in_numPages;
+		size_t runStart = page;
+		size_t runLength = 0;
+
+		while (page < numPages && page < end)
+		{
+			const uint64_t word = pageBitmap[page / 64];
+
+			// Skip fully used words in one step
+			if (page % 64 == 0 && word == ~0ull)
+			{
+				page += 64;
+				runStart = page;
+				runLength = 0;
+				continue;
+			}
+
+			if (word & (1ull << (page % 64)))
+			{
+				runStart = page + 1;
+				runLength = 0;
+			}
+			else if (++runLength == in_numPages)
+			{
+				return runStart;
+			}
+
+			++page;
+		}
+	}
+
+	return numPages;
+}
+
+void CAkMemoryPoolGodot::MarkPages(size_t in_firstPage, size_t in_numPages, bool in_used)
+{
+	AKASSERT(in_firstPage + in_numPages <= numPages);
+
+	for (size_t page = in_firstPage; page < in_firstPage + in_numPages; ++page)
+	{
+		const uint64_t mask = 1ull << (page % 64);
+
+		if (in_used)
+		{
+			AKASSERT(!(pageBitmap[page / 64] & mask));
+			pageBitmap[page / 64] |= mask;
+		}
+		else
+		{
+			AKASSERT(pageBitmap[page / 64] & mask);
+			pageBitmap[page / 64] &= ~mask;
+		}
+	}
+}
@@ -0,0 +1,58 @@
+#ifndef __WWISE_MEMORY_H__
+#define __WWISE_MEMORY_H__
+
+#include <Dictionary.hpp>
+#include <AK/SoundEngine/Common/AkTypes.h>
+#include <AK/SoundEngine/Common/AkMemoryMgr.h>
+#include <AK/Tools/Common/AkLock.h>
+#include <AK/Tools/Common/AkAutoLock.h>
+
+#include <atomic>
+#include <vector>
+
+namespace godot
+{
+	// Fixed-size arena backing the virtual memory hooks of the Wwise memory manager. The whole budget is reserved
+	// up front and handed out in page-aligned spans, so the sound engine never goes back to the system allocator
+	// once initialised and can never grow past the configured budget.
+	class CAkMemoryPoolGodot
+	{
+	public:
+		static const size_t PAGE_SIZE = 64 * 1024;
+
+		static bool Init(size_t in_budgetBytes);
+		static void Term();
+		static bool IsInitialized();
+
+		// Installs the virtual memory hooks, to be called before AK::MemoryMgr::Init
+		static void SetupMemSettings(AkMemSettings& io_memSettings);
+
+		static void* AllocVM(size_t in_size, size_t* out_extra);
+		static void FreeVM(void* in_address, size_t in_size, size_t in_extra, size_t in_release);
+
+		static size_t GetBudget();
+		static size_t GetUsed();
+		static size_t GetPeakUsed();
+		static size_t GetFailedAllocations();
+
+		// Fills the pool usage and the per-category usage reported by the memory manager
+		static Dictionary GetStats();
+
+	private:
+		static size_t FindFreeRun(size_t in_numPages);
+		static void MarkPages(size_t in_firstPage, size_t in_numPages, bool in_used);
+
+		static CAkLock lock;
+		static void* reservedBlock;
+		static char* poolStart;
+		static size_t numPages;
+		static size_t searchHint;
+		static std::vector<uint64_t> pageBitmap;
+
+		static std::atomic<size_t> usedBytes;
+		static std::atomic<size_t> peakUsedBytes;
+		static std::atomic<size_t> failedAllocations;
+	};
+}
+
+#endif
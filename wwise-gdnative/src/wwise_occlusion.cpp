@@ -0,0 +1,212 @@
+#include "wwise_occlusion.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace godot;
+
+constexpr float WwiseOcclusionManager::OCCLUSION_EPSILON;
+
+void WwiseOcclusionManager::addEmitter(const uint64_t emitterID, const uint64_t listenerID, const int priority)
+{
+	removeEmitter(emitterID);
+
+	Emitter emitter;
+	emitter.listenerID = listenerID;
+	emitter.priority = std::max(priority, 0);
+	emitters.emplace(emitterID, emitter);
+
+	addReference(emitterID);
+	addReference(listenerID);
+}
+
+bool WwiseOcclusionManager::removeEmitter(const uint64_t emitterID)
+{
+	auto emitter = emitters.find(emitterID);
+
+	if (emitter == emitters.end())
+	{
+		return false;
+	}
+
+	const uint64_t listenerID = emitter->second.listenerID;
+	emitters.erase(emitter);
+
+	releaseReference(emitterID);
+	releaseReference(listenerID);
+
+	return true;
+}
+
+void WwiseOcclusionManager::removeGameObject(const uint64_t gameObjectID)
+{
+	removeEmitter(gameObjectID);
+
+	for (auto emitter = emitters.begin(); emitter != emitters.end();)
+	{
+		if (emitter->second.listenerID == gameObjectID)
+		{
+			const uint64_t emitterID = emitter->first;
+			emitter = emitters.erase(emitter);
+
+			releaseReference(emitterID);
+			releaseReference(gameObjectID);
+		}
+		else
+		{
+			++emitter;
+		}
+	}
+}
+
+void WwiseOcclusionManager::setPosition(const uint64_t gameObjectID, const Vector3& position)
+{
+	auto trackedPosition = positions.find(gameObjectID);
+
+	if (trackedPosition != positions.end())
+	{
+		trackedPosition->second.position = position;
+		trackedPosition->second.positioned = true;
+	}
+}
+
+bool WwiseOcclusionManager::getOcclusion(const uint64_t emitterID, float& out_occlusion) const
+{
+	auto emitter = emitters.find(emitterID);
+
+	if (emitter == emitters.end())
+	{
+		return false;
+	}
+
+	out_occlusion = emitter->second.occlusion;
+	return true;
+}
+
+void WwiseOcclusionManager::setActive(const uint64_t emitterID, const bool active)
+{
+	auto emitter = emitters.find(emitterID);
+
+	if (emitter != emitters.end())
+	{
+		emitter->second.active = active;
+	}
+}
+
+void WwiseOcclusionManager::update(const unsigned int rayBudget, const float delta, const float smoothingTime,
+								   const RayCaster& castRay, std::vector<OcclusionChange>& out_changes)
+{
+	schedule.clear();
+
+	// Waiting emitters build up urgency every frame so low priority and far away ones still get their turn
+	for (auto& emitter : emitters)
+	{
+		const TrackedPosition* emitterPosition = findPosition(emitter.first);
+		const TrackedPosition* listenerPosition = findPosition(emitter.second.listenerID);
+
+		if (!emitter.second.active || !emitterPosition || !listenerPosition)
+		{
+			continue;
+		}
+
+		const Vector3 offset = listenerPosition->position - emitterPosition->position;
+		const float distance = std::sqrt(offset.x * offset.x + offset.y * offset.y + offset.z * offset.z);
+
+		emitter.second.urgency += (1.0f + static_cast<float>(emitter.second.priority)) / (1.0f + distance);
+		schedule.emplace_back(emitter.second.urgency, emitter.first);
+	}
+
+	// Every emitter takes at least one ray, only that many can be served this frame
+	const size_t emitterCount = rayBudget == 0 ? schedule.size() : std::min<size_t>(rayBudget, schedule.size());
+
+	std::partial_sort(schedule.begin(), schedule.begin() + emitterCount, schedule.end(),
+					  [](const std::pair<float, uint64_t>& a, const std::pair<float, uint64_t>& b) {
+						  return a.first > b.first;
+					  });
+
+	unsigned int raysLeft = rayBudget;
+
+	for (size_t i = 0; i < emitterCount && (rayBudget == 0 || raysLeft > 0); ++i)
+	{
+		Emitter& emitter = emitters[schedule[i].second];
+
+		const RayResult result = castRay(schedule[i].second, findPosition(schedule[i].second)->position,
+										 findPosition(emitter.listenerID)->position, raysLeft);
+		raysLeft -= std::min(result.rays, raysLeft);
+
+		// A result cut short by the rays left is dropped, the emitter keeps its urgency and starts the next frame
+		// with the whole budget. Only the first emitter of a frame settles for a lower bound, when the budget is
+		// smaller than the colliders in its way.
+		if (!result.complete && i > 0)
+		{
+			break;
+		}
+
+		emitter.target = result.occlusion;
+		emitter.urgency = 0.0f;
+
+		// The first result is applied as is, there is nothing to smooth from yet
+		if (!emitter.sampled)
+		{
+			emitter.occlusion = emitter.target;
+			emitter.sampled = true;
+		}
+	}
+
+	const float blend = smoothingTime > 0.0f ? std::min(delta / smoothingTime, 1.0f) : 1.0f;
+
+	for (auto& emitter : emitters)
+	{
+		Emitter& state = emitter.second;
+
+		if (!state.sampled || !state.active)
+		{
+			continue;
+		}
+
+		state.occlusion += (state.target - state.occlusion) * blend;
+
+		if (std::abs(state.target - state.occlusion) <= OCCLUSION_EPSILON)
+		{
+			state.occlusion = state.target;
+		}
+
+		if (!state.sent || std::abs(state.occlusion - state.sentOcclusion) > OCCLUSION_EPSILON ||
+			(state.occlusion == state.target && state.sentOcclusion != state.target))
+		{
+			state.sentOcclusion = state.occlusion;
+			state.sent = true;
+			out_changes.push_back({emitter.first, state.listenerID, state.occlusion});
+		}
+	}
+}
+
+void WwiseOcclusionManager::clear()
+{
+	emitters.clear();
+	positions.clear();
+	schedule.clear();
+}
+
+void WwiseOcclusionManager::addReference(const uint64_t gameObjectID)
+{
+	++positions[gameObjectID].references;
+}
+
+void WwiseOcclusionManager::releaseReference(const uint64_t gameObjectID)
+{
+	auto trackedPosition = positions.find(gameObjectID);
+
+	if (trackedPosition != positions.end() && --trackedPosition->second.references <= 0)
+	{
+		positions.erase(trackedPosition);
+	}
+}
+
+const WwiseOcclusionManager::TrackedPosition* WwiseOcclusionManager::findPosition(const uint64_t gameObjectID) const
+{
+	auto trackedPosition = positions.find(gameObjectID);
+
+	return trackedPosition != positions.end() && trackedPosition->second.positioned ? &trackedPosition->second
+																						 : nullptr;
+}
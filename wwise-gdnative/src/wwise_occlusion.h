@@ -0,0 +1,97 @@
+#ifndef WWISE_OCCLUSION_H
+#define WWISE_OCCLUSION_H
+
+#include <Vector3.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace godot
+{
+// Schedules the occlusion rays between emitters and their listener under a per-frame budget, replacing the RayCast
+// node and per-frame script of AkEvent. Emitters are served round robin, weighted by priority and by how close they
+// are to their listener, so every emitter is eventually updated. Results are smoothed over time and only the values
+// that changed are returned.
+class WwiseOcclusionManager
+{
+  public:
+	struct OcclusionChange
+	{
+		uint64_t emitterID;
+		uint64_t listenerID;
+		float occlusion;
+	};
+
+	struct RayResult
+	{
+		// From 0 to 1
+		float occlusion;
+		unsigned int rays;
+		// False when maxRays ran out before the occlusion was known, occlusion is then only a lower bound
+		bool complete;
+	};
+
+	// Finds the occlusion between the two positions with at most maxRays rays, 0 for no limit
+	using RayCaster = std::function<RayResult(const uint64_t emitterID, const Vector3& from, const Vector3& to,
+											  const unsigned int maxRays)>;
+
+	// Higher priorities are updated more often, negative priorities count as 0
+	void addEmitter(const uint64_t emitterID, const uint64_t listenerID, const int priority);
+	bool removeEmitter(const uint64_t emitterID);
+	// Removes the emitter, or every emitter of the listener
+	void removeGameObject(const uint64_t gameObjectID);
+	// Ignored for game objects that are neither an emitter nor a listener
+	void setPosition(const uint64_t gameObjectID, const Vector3& position);
+	bool getOcclusion(const uint64_t emitterID, float& out_occlusion) const;
+	// Inactive emitters keep their last occlusion and get no rays until they are active again
+	void setActive(const uint64_t emitterID, const bool active);
+
+	bool empty() const
+	{
+		return emitters.empty();
+	}
+
+	// Casts at most rayBudget rays in total, every ray of every emitter counted, 0 updates every emitter. Appends the
+	// emitters whose smoothed occlusion changed.
+	void update(const unsigned int rayBudget, const float delta, const float smoothingTime, const RayCaster& castRay,
+				std::vector<OcclusionChange>& out_changes);
+	void clear();
+
+  private:
+	struct Emitter
+	{
+		uint64_t listenerID;
+		int priority;
+		float urgency = 0.0f;
+		float target = 0.0f;
+		float occlusion = 0.0f;
+		float sentOcclusion = 0.0f;
+		bool sampled = false;
+		bool sent = false;
+		bool active = true;
+	};
+
+	struct TrackedPosition
+	{
+		Vector3 position;
+		bool positioned = false;
+		// Emitters using this game object, as themselves or as their listener
+		int references = 0;
+	};
+
+	void addReference(const uint64_t gameObjectID);
+	void releaseReference(const uint64_t gameObjectID);
+	const TrackedPosition* findPosition(const uint64_t gameObjectID) const;
+
+	// Occlusion values closer than this are not sent again
+	static constexpr float OCCLUSION_EPSILON = 0.001f;
+
+	std::unordered_map<uint64_t, Emitter> emitters;
+	std::unordered_map<uint64_t, TrackedPosition> positions;
+	std::vector<std::pair<float, uint64_t>> schedule;
+};
+} // namespace godot
+
+#endif
@@ -0,0 +1,161 @@
+#include "wwise_profiler.h"
+
+#if !defined(AK_OPTIMIZED)
+
+#include <Dictionary.hpp>
+#include <String.hpp>
+#include <AK/Tools/Common/AkAutoLock.h>
+
+#include <algorithm>
+
+using namespace godot;
+
+std::atomic<bool> WwiseApiProfiler::enabled{false};
+std::atomic<int> WwiseApiProfiler::methodCount{0};
+const char* WwiseApiProfiler::methodNames[WwiseApiProfiler::MAX_METHODS] = {};
+
+CAkLock WwiseApiProfiler::threadSlotsLock;
+std::vector<std::unique_ptr<WwiseApiProfiler::ThreadSlots>> WwiseApiProfiler::threadSlots;
+
+uint32_t WwiseApiProfiler::frameCalls[WwiseApiProfiler::MAX_METHODS] = {};
+uint64_t WwiseApiProfiler::frameTimeNsec[WwiseApiProfiler::MAX_METHODS] = {};
+uint64_t WwiseApiProfiler::totalCalls[WwiseApiProfiler::MAX_METHODS] = {};
+uint64_t WwiseApiProfiler::totalTimeNsec[WwiseApiProfiler::MAX_METHODS] = {};
+
+WwiseApiProfiler::Scope::Scope(const int methodID)
+	: methodID(methodID), active(methodID >= 0 && enabled.load(std::memory_order_relaxed))
+{
+	if (active)
+	{
+		start = std::chrono::steady_clock::now();
+	}
+}
+
+WwiseApiProfiler::Scope::~Scope()
+{
+	if (!active)
+	{
+		return;
+	}
+
+	const uint64_t elapsedNsec = static_cast<uint64_t>(
+		std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+
+	ThreadSlots* slots = getThreadSlots();
+	slots->calls[methodID].fetch_add(1, std::memory_order_relaxed);
+	slots->timeNsec[methodID].fetch_add(elapsedNsec, std::memory_order_relaxed);
+}
+
+int WwiseApiProfiler::registerMethod(const char* name)
+{
+	// Called once per instrumented method through a function-local static
+	const int methodID = methodCount.fetch_add(1);
+
+	if (methodID >= MAX_METHODS)
+	{
+		return -1;
+	}
+
+	methodNames[methodID] = name;
+	return methodID;
+}
+
+void WwiseApiProfiler::setEnabled(const bool enable)
+{
+	enabled = enable;
+}
+
+bool WwiseApiProfiler::isEnabled()
+{
+	return enabled;
+}
+
+void WwiseApiProfiler::endFrame()
+{
+	if (!enabled.load(std::memory_order_relaxed))
+	{
+		return;
+	}
+
+	const int numMethods = std::min(methodCount.load(), static_cast<int>(MAX_METHODS));
+
+	std::fill(frameCalls, frameCalls + MAX_METHODS, 0);
+	std::fill(frameTimeNsec, frameTimeNsec + MAX_METHODS, 0);
+
+	AkAutoLock<CAkLock> scopedLock(threadSlotsLock);
+
+	for (const std::unique_ptr<ThreadSlots>& slots : threadSlots)
+	{
+		for (int methodID = 0; methodID < numMethods; ++methodID)
+		{
+			frameCalls[methodID] += slots->calls[methodID].exchange(0, std::memory_order_relaxed);
+			frameTimeNsec[methodID] += slots->timeNsec[methodID].exchange(0, std::memory_order_relaxed);
+		}
+	}
+
+	for (int methodID = 0; methodID < numMethods; ++methodID)
+	{
+		totalCalls[methodID] += frameCalls[methodID];
+		totalTimeNsec[methodID] += frameTimeNsec[methodID];
+	}
+}
+
+Array WwiseApiProfiler::getReport(const int count)
+{
+	const int numMethods = std::min(methodCount.load(), static_cast<int>(MAX_METHODS));
+
+	std::vector<int> methodIDs;
+	methodIDs.reserve(numMethods);
+
+	for (int methodID = 0; methodID < numMethods; ++methodID)
+	{
+		if (totalCalls[methodID] > 0)
+		{
+			methodIDs.push_back(methodID);
+		}
+	}
+
+	std::sort(methodIDs.begin(), methodIDs.end(), [](const int a, const int b) {
+		if (frameTimeNsec[a] != frameTimeNsec[b])
+		{
+			return frameTimeNsec[a] > frameTimeNsec[b];
+		}
+
+		return totalTimeNsec[a] > totalTimeNsec[b];
+	});
+
+	Array report;
+
+	for (int i = 0; i < static_cast<int>(methodIDs.size()) && (count <= 0 || i < count); ++i)
+	{
+		const int methodID = methodIDs[i];
+
+		Dictionary entry;
+		entry["method"] = String(methodNames[methodID]);
+		entry["frame_calls"] = static_cast<unsigned int>(frameCalls[methodID]);
+		entry["frame_time_ms"] = static_cast<float>(frameTimeNsec[methodID] / 1000000.0);
+		entry["total_calls"] = static_cast<int64_t>(totalCalls[methodID]);
+		entry["total_time_ms"] = static_cast<float>(totalTimeNsec[methodID] / 1000000.0);
+
+		report.append(entry);
+	}
+
+	return report;
+}
+
+WwiseApiProfiler::ThreadSlots* WwiseApiProfiler::getThreadSlots()
+{
+	thread_local ThreadSlots* slots = nullptr;
+
+	if (!slots)
+	{
+		AkAutoLock<CAkLock> scopedLock(threadSlotsLock);
+
+		threadSlots.emplace_back(new ThreadSlots());
+		slots = threadSlots.back().get();
+	}
+
+	return slots;
+}
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef WWISE_PROFILER_H
+#define WWISE_PROFILER_H
+
+#include <Array.hpp>
+
+#if !defined(AK_OPTIMIZED)
+
+#include <AK/Tools/Common/AkLock.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace godot
+{
+// Opt-in call counters and timings for the methods exposed to GDScript. Every thread that calls into the API gets
+// its own slots, written with relaxed atomics only, and the main thread folds them into per-frame totals once per
+// _process. Not compiled in optimized builds.
+class WwiseApiProfiler
+{
+  public:
+	static const int MAX_METHODS = 128;
+
+	class Scope
+	{
+	  public:
+		explicit Scope(const int methodID);
+		~Scope();
+
+	  private:
+		const int methodID;
+		std::chrono::steady_clock::time_point start;
+		bool active;
+	};
+
+	static int registerMethod(const char* name);
+
+	static void setEnabled(const bool enable);
+	static bool isEnabled();
+
+	// Collects the calls made since the previous call and resets the per-thread slots
+	static void endFrame();
+
+	// Methods sorted by their time during the last frame, limited to the first count entries
+	static Array getReport(const int count);
+
+  private:
+	struct ThreadSlots
+	{
+		std::atomic<uint32_t> calls[MAX_METHODS];
+		std::atomic<uint64_t> timeNsec[MAX_METHODS];
+	};
+
+	static ThreadSlots* getThreadSlots();
+
+	static std::atomic<bool> enabled;
+	static std::atomic<int> methodCount;
+	static const char* methodNames[MAX_METHODS];
+
+	static CAkLock threadSlotsLock;
+	static std::vector<std::unique_ptr<ThreadSlots>> threadSlots;
+
+	static uint32_t frameCalls[MAX_METHODS];
+	static uint64_t frameTimeNsec[MAX_METHODS];
+	static uint64_t totalCalls[MAX_METHODS];
+	static uint64_t totalTimeNsec[MAX_METHODS];
+};
+} // namespace godot
+
+// Counts and times the enclosing API method, one per function body
+#define WWISE_PROFILE_SCOPE(name)                                                                                      \
+	static const int profileMethodID = WwiseApiProfiler::registerMethod(name);                                         \
+	WwiseApiProfiler::Scope profileScope(profileMethodID);
+
+#else
+
+#define WWISE_PROFILE_SCOPE(name)
+
+#endif
+
+#endif
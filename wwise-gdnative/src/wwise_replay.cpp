@@ -0,0 +1,562 @@
+#include "wwise_replay.h"
+
+#include <Dictionary.hpp>
+#include <File.hpp>
+#include <PoolArrays.hpp>
+#include <Resource.hpp>
+#include <ResourceLoader.hpp>
+#include <Transform.hpp>
+#include <Transform2D.hpp>
+#include <Vector3.hpp>
+#include <AK/Tools/Common/AkAutoLock.h>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+using namespace godot;
+
+CAkLock WwiseCallLog::lock;
+std::atomic<bool> WwiseCallLog::recording{false};
+std::atomic<int> WwiseCallLog::methodCount{0};
+const char* WwiseCallLog::methodNames[WwiseCallLog::MAX_METHODS] = {};
+
+uint32_t WwiseCallLog::frame = 0;
+std::vector<uint8_t> WwiseCallLog::buffer;
+std::unordered_map<int64_t, uint32_t> WwiseCallLog::gameObjectIndices;
+
+template <typename T> static void WriteValue(std::vector<uint8_t>& out, const T value)
+{
+	const size_t offset = out.size();
+	out.resize(offset + sizeof(T));
+	std::memcpy(out.data() + offset, &value, sizeof(T));
+}
+
+static void WriteString(std::vector<uint8_t>& out, const String& value)
+{
+	const CharString utf8 = value.utf8();
+	const uint32_t length = static_cast<uint32_t>(utf8.length());
+
+	WriteValue(out, length);
+	out.insert(out.end(), utf8.get_data(), utf8.get_data() + length);
+}
+
+static void WriteVector3(std::vector<uint8_t>& out, const Vector3& value)
+{
+	WriteValue(out, static_cast<float>(value.x));
+	WriteValue(out, static_cast<float>(value.y));
+	WriteValue(out, static_cast<float>(value.z));
+}
+
+// Bounds-checked cursor over a loaded log, any read past the end marks the whole log as invalid
+struct WwiseCallLog::Reader
+{
+	const uint8_t* data;
+	size_t size;
+	size_t position;
+	bool valid;
+	// From the header, game object indices at or past it mark the log as invalid
+	uint32_t gameObjectCount;
+
+	template <typename T> T read()
+	{
+		T value{};
+
+		if (position + sizeof(T) > size)
+		{
+			valid = false;
+			return value;
+		}
+
+		std::memcpy(&value, data + position, sizeof(T));
+		position += sizeof(T);
+		return value;
+	}
+
+	String readString()
+	{
+		const uint32_t length = read<uint32_t>();
+
+		if (!valid || position + length > size)
+		{
+			valid = false;
+			return String();
+		}
+
+		const std::string utf8(reinterpret_cast<const char*>(data + position), length);
+		const String value = String(utf8.c_str());
+		position += length;
+		return value;
+	}
+
+	Vector3 readVector3()
+	{
+		const float x = read<float>();
+		const float y = read<float>();
+		const float z = read<float>();
+		return Vector3(x, y, z);
+	}
+
+	bool atEnd() const
+	{
+		return position >= size;
+	}
+
+	size_t remaining() const
+	{
+		return position < size ? size - position : 0;
+	}
+};
+
+Variant WwiseCallLog::readArgument(Reader& reader, std::vector<Node*>& gameObjects, const int depth)
+{
+	if (depth > MAX_ARGUMENT_DEPTH)
+	{
+		reader.valid = false;
+		return Variant();
+	}
+
+	switch (reader.read<uint8_t>())
+	{
+	case ARGUMENT_BOOL:
+		return reader.read<uint8_t>() != 0;
+	case ARGUMENT_INT:
+		return reader.read<int64_t>();
+	case ARGUMENT_REAL:
+		return reader.read<double>();
+	case ARGUMENT_STRING:
+		return reader.readString();
+	case ARGUMENT_VECTOR3:
+		return reader.readVector3();
+	case ARGUMENT_TRANSFORM:
+	{
+		Transform transform;
+		transform.basis.elements[0] = reader.readVector3();
+		transform.basis.elements[1] = reader.readVector3();
+		transform.basis.elements[2] = reader.readVector3();
+		transform.origin = reader.readVector3();
+		return transform;
+	}
+	case ARGUMENT_TRANSFORM2D:
+	{
+		Transform2D transform2D;
+
+		for (int i = 0; i < 3; ++i)
+		{
+			transform2D.elements[i].x = reader.read<float>();
+			transform2D.elements[i].y = reader.read<float>();
+		}
+
+		return transform2D;
+	}
+	case ARGUMENT_ARRAY:
+	{
+		Array array;
+		const uint32_t size = reader.read<uint32_t>();
+
+		for (uint32_t i = 0; i < size && reader.valid; ++i)
+		{
+			array.append(readArgument(reader, gameObjects, depth + 1));
+		}
+
+		return array;
+	}
+	case ARGUMENT_DICTIONARY:
+	{
+		Dictionary dictionary;
+		const uint32_t size = reader.read<uint32_t>();
+
+		for (uint32_t i = 0; i < size && reader.valid; ++i)
+		{
+			const Variant key = readArgument(reader, gameObjects, depth + 1);
+			dictionary[key] = readArgument(reader, gameObjects, depth + 1);
+		}
+
+		return dictionary;
+	}
+	case ARGUMENT_GAME_OBJECT:
+	{
+		const uint32_t index = reader.read<uint32_t>();
+
+		if (index == INVALID_GAME_OBJECT_INDEX || !reader.valid)
+		{
+			return Variant();
+		}
+
+		if (index >= reader.gameObjectCount)
+		{
+			reader.valid = false;
+			return Variant();
+		}
+
+		while (gameObjects.size() <= index)
+		{
+			Node* placeholder = Node::_new();
+			placeholder->set_name("ReplayGameObject" + String::num_int64(gameObjects.size()));
+			gameObjects.push_back(placeholder);
+		}
+
+		return gameObjects[index];
+	}
+	case ARGUMENT_RESOURCE:
+	{
+		const String path = reader.readString();
+		Ref<Resource> resource = ResourceLoader::get_singleton()->load(path);
+		return resource.ptr();
+	}
+	case ARGUMENT_POOL_INT_ARRAY:
+	{
+		PoolIntArray array;
+		const uint32_t size = reader.read<uint32_t>();
+
+		for (uint32_t i = 0; i < size && reader.valid; ++i)
+		{
+			array.append(reader.read<int32_t>());
+		}
+
+		return array;
+	}
+	case ARGUMENT_POOL_VECTOR3_ARRAY:
+	{
+		PoolVector3Array array;
+		const uint32_t size = reader.read<uint32_t>();
+
+		for (uint32_t i = 0; i < size && reader.valid; ++i)
+		{
+			array.append(reader.readVector3());
+		}
+
+		return array;
+	}
+	default:
+		return Variant();
+	}
+}
+
+int WwiseCallLog::registerMethod(const char* name)
+{
+	// Called once per recorded method through a function-local static
+	const int methodID = methodCount.fetch_add(1);
+
+	if (methodID >= MAX_METHODS)
+	{
+		return -1;
+	}
+
+	methodNames[methodID] = name;
+	return methodID;
+}
+
+void WwiseCallLog::start()
+{
+	AkAutoLock<CAkLock> scopedLock(lock);
+
+	frame = 0;
+	buffer.clear();
+	gameObjectIndices.clear();
+	recording = true;
+}
+
+void WwiseCallLog::stop()
+{
+	recording = false;
+}
+
+bool WwiseCallLog::isRecording()
+{
+	return recording.load(std::memory_order_relaxed);
+}
+
+void WwiseCallLog::record(const int methodID, std::initializer_list<Variant> arguments)
+{
+	if (methodID < 0)
+	{
+		return;
+	}
+
+	AkAutoLock<CAkLock> scopedLock(lock);
+
+	if (!recording)
+	{
+		return;
+	}
+
+	WriteValue(buffer, frame);
+	WriteValue(buffer, static_cast<uint16_t>(methodID));
+	WriteValue(buffer, static_cast<uint8_t>(arguments.size()));
+
+	for (const Variant& argument : arguments)
+	{
+		writeArgument(argument);
+	}
+}
+
+void WwiseCallLog::endFrame()
+{
+	if (isRecording())
+	{
+		AkAutoLock<CAkLock> scopedLock(lock);
+		++frame;
+	}
+}
+
+bool WwiseCallLog::save(const String path)
+{
+	AkAutoLock<CAkLock> scopedLock(lock);
+
+	std::vector<uint8_t> header;
+	WriteValue(header, LOG_MAGIC);
+	WriteValue(header, LOG_VERSION);
+
+	// Method IDs are only stable within a session, the table maps them back to the names the replay calls
+	const int numMethods = std::min(methodCount.load(), static_cast<int>(MAX_METHODS));
+	WriteValue(header, static_cast<uint32_t>(numMethods));
+
+	for (int methodID = 0; methodID < numMethods; ++methodID)
+	{
+		WriteString(header, String(methodNames[methodID]));
+	}
+
+	WriteValue(header, static_cast<uint32_t>(gameObjectIndices.size()));
+
+	PoolByteArray data;
+	data.resize(static_cast<int>(header.size() + buffer.size()));
+
+	{
+		PoolByteArray::Write dataWrite = data.write();
+		std::copy(header.begin(), header.end(), dataWrite.ptr());
+		std::copy(buffer.begin(), buffer.end(), dataWrite.ptr() + header.size());
+	}
+
+	File* const file = File::_new();
+
+	if (file->open(path, File::ModeFlags::WRITE) != Error::OK)
+	{
+		file->free();
+		return false;
+	}
+
+	file->store_buffer(data);
+	file->close();
+	file->free();
+
+	return true;
+}
+
+bool WwiseCallLog::load(const String path, std::vector<Call>& out_calls, std::vector<Node*>& out_gameObjects)
+{
+	File* const file = File::_new();
+
+	if (file->open(path, File::ModeFlags::READ) != Error::OK)
+	{
+		file->free();
+		return false;
+	}
+
+	const PoolByteArray data = file->get_buffer(file->get_len());
+	file->close();
+	file->free();
+
+	PoolByteArray::Read dataRead = data.read();
+	Reader reader{dataRead.ptr(), static_cast<size_t>(data.size()), 0, true, 0};
+
+	if (reader.read<uint32_t>() != LOG_MAGIC || reader.read<uint32_t>() != LOG_VERSION)
+	{
+		return false;
+	}
+
+	// Counts are checked against what the rest of the log could hold before anything is allocated from them, each
+	// method name takes at least its length and each game object at least one argument of a call
+	const uint32_t numMethods = reader.read<uint32_t>();
+
+	if (!reader.valid || numMethods > MAX_METHODS || numMethods > reader.remaining() / sizeof(uint32_t))
+	{
+		return false;
+	}
+
+	std::vector<String> methods(numMethods);
+
+	for (String& method : methods)
+	{
+		method = reader.readString();
+	}
+
+	reader.gameObjectCount = reader.read<uint32_t>();
+
+	if (!reader.valid || reader.gameObjectCount > reader.remaining() / (sizeof(uint8_t) + sizeof(uint32_t)))
+	{
+		return false;
+	}
+
+	out_gameObjects.reserve(reader.gameObjectCount);
+
+	uint32_t previousFrame = 0;
+
+	while (reader.valid && !reader.atEnd())
+	{
+		Call call;
+		call.frame = reader.read<uint32_t>();
+
+		// Calls are written in the order they were made, so frames never go backwards
+		if (call.frame < previousFrame || call.frame - previousFrame > MAX_FRAME_GAP)
+		{
+			reader.valid = false;
+			break;
+		}
+
+		previousFrame = call.frame;
+
+		const uint16_t methodID = reader.read<uint16_t>();
+		const uint8_t numArguments = reader.read<uint8_t>();
+
+		for (uint8_t i = 0; i < numArguments && reader.valid; ++i)
+		{
+			call.arguments.append(readArgument(reader, out_gameObjects, 0));
+		}
+
+		if (methodID >= methods.size())
+		{
+			reader.valid = false;
+			break;
+		}
+
+		call.method = methods[methodID];
+		out_calls.push_back(call);
+	}
+
+	return reader.valid;
+}
+
+void WwiseCallLog::writeArgument(const Variant& argument)
+{
+	switch (argument.get_type())
+	{
+	case Variant::BOOL:
+		WriteValue(buffer, static_cast<uint8_t>(ARGUMENT_BOOL));
+		WriteValue(buffer, static_cast<uint8_t>(static_cast<bool>(argument)));
+		break;
+	case Variant::INT:
+		WriteValue(buffer, static_cast<uint8_t>(ARGUMENT_INT));
+		WriteValue(buffer, static_cast<int64_t>(argument));
+		break;
+	case Variant::REAL:
+		WriteValue(buffer, static_cast<uint8_t>(ARGUMENT_REAL));
+		WriteValue(buffer, static_cast<double>(argument));
+		break;
+	case Variant::STRING:
+		WriteValue(buffer, static_cast<uint8_t>(ARGUMENT_STRING));
+		WriteString(buffer, argument);
+		break;
+	case Variant::VECTOR3:
+		WriteValue(buffer, static_cast<uint8_t>(ARGUMENT_VECTOR3));
+		WriteVector3(buffer, argument);
+		break;
+	case Variant::TRANSFORM:
+	{
+		const Transform transform = argument;
+		WriteValue(buffer, static_cast<uint8_t>(ARGUMENT_TRANSFORM));
+		WriteVector3(buffer, transform.basis.elements[0]);
+		WriteVector3(buffer, transform.basis.elements[1]);
+		WriteVector3(buffer, transform.basis.elements[2]);
+		WriteVector3(buffer, transform.origin);
+		break;
+	}
+	case Variant::TRANSFORM2D:
+	{
+		const Transform2D transform2D = argument;
+		WriteValue(buffer, static_cast<uint8_t>(ARGUMENT_TRANSFORM2D));
+
+		for (int i = 0; i < 3; ++i)
+		{
+			WriteValue(buffer, static_cast<float>(transform2D.elements[i].x));
+			WriteValue(buffer, static_cast<float>(transform2D.elements[i].y));
+		}
+
+		break;
+	}
+	case Variant::ARRAY:
+	{
+		const Array array = argument;
+		WriteValue(buffer, static_cast<uint8_t>(ARGUMENT_ARRAY));
+		WriteValue(buffer, static_cast<uint32_t>(array.size()));
+
+		for (int i = 0; i < array.size(); ++i)
+		{
+			writeArgument(array[i]);
+		}
+
+		break;
+	}
+	case Variant::DICTIONARY:
+	{
+		const Dictionary dictionary = argument;
+		const Array keys = dictionary.keys();
+		WriteValue(buffer, static_cast<uint8_t>(ARGUMENT_DICTIONARY));
+		WriteValue(buffer, static_cast<uint32_t>(keys.size()));
+
+		for (int i = 0; i < keys.size(); ++i)
+		{
+			writeArgument(keys[i]);
+			writeArgument(dictionary[keys[i]]);
+		}
+
+		break;
+	}
+	case Variant::OBJECT:
+	{
+		const Object* object = argument;
+		const Resource* resource = Object::cast_to<Resource>(object);
+
+		if (resource)
+		{
+			WriteValue(buffer, static_cast<uint8_t>(ARGUMENT_RESOURCE));
+			WriteString(buffer, resource->get_path());
+			break;
+		}
+
+		uint32_t index = INVALID_GAME_OBJECT_INDEX;
+
+		if (object)
+		{
+			const auto inserted = gameObjectIndices.emplace(object->get_instance_id(),
+															static_cast<uint32_t>(gameObjectIndices.size()));
+			index = inserted.first->second;
+		}
+
+		WriteValue(buffer, static_cast<uint8_t>(ARGUMENT_GAME_OBJECT));
+		WriteValue(buffer, index);
+		break;
+	}
+	case Variant::POOL_INT_ARRAY:
+	{
+		const PoolIntArray array = argument;
+		PoolIntArray::Read arrayRead = array.read();
+		WriteValue(buffer, static_cast<uint8_t>(ARGUMENT_POOL_INT_ARRAY));
+		WriteValue(buffer, static_cast<uint32_t>(array.size()));
+
+		for (int i = 0; i < array.size(); ++i)
+		{
+			WriteValue(buffer, static_cast<int32_t>(arrayRead[i]));
+		}
+
+		break;
+	}
+	case Variant::POOL_VECTOR3_ARRAY:
+	{
+		const PoolVector3Array array = argument;
+		PoolVector3Array::Read arrayRead = array.read();
+		WriteValue(buffer, static_cast<uint8_t>(ARGUMENT_POOL_VECTOR3_ARRAY));
+		WriteValue(buffer, static_cast<uint32_t>(array.size()));
+
+		for (int i = 0; i < array.size(); ++i)
+		{
+			WriteVector3(buffer, arrayRead[i]);
+		}
+
+		break;
+	}
+	default:
+		WriteValue(buffer, static_cast<uint8_t>(ARGUMENT_NIL));
+		break;
+	}
+}
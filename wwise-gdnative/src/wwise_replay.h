@@ -0,0 +1,99 @@
+#ifndef WWISE_REPLAY_H
+#define WWISE_REPLAY_H
+
+#include <Array.hpp>
+#include <Node.hpp>
+#include <String.hpp>
+#include <Variant.hpp>
+#include <AK/Tools/Common/AkLock.h>
+
+#include <atomic>
+#include <cstdint>
+#include <initializer_list>
+#include <unordered_map>
+#include <vector>
+
+namespace godot
+{
+// Records the calls made to the Wwise API into a compact binary log, one entry per call with the frame it was made
+// in, the method and its arguments. Game objects are remapped to stable indices in the order they first appear and
+// resources are stored by path, so a log captured in one session can be replayed in another.
+class WwiseCallLog
+{
+  public:
+	struct Call
+	{
+		uint32_t frame;
+		String method;
+		Array arguments;
+	};
+
+	static int registerMethod(const char* name);
+
+	static void start();
+	static void stop();
+	static bool isRecording();
+
+	static void record(const int methodID, std::initializer_list<Variant> arguments);
+	static void endFrame();
+
+	// Writes the recorded calls to path, user:// paths are supported
+	static bool save(const String path);
+
+	// Reads a log written by save, game objects are replaced by placeholder nodes owned by the caller
+	static bool load(const String path, std::vector<Call>& out_calls, std::vector<Node*>& out_gameObjects);
+
+  private:
+	enum ArgumentType : uint8_t
+	{
+		ARGUMENT_NIL = 0,
+		ARGUMENT_BOOL,
+		ARGUMENT_INT,
+		ARGUMENT_REAL,
+		ARGUMENT_STRING,
+		ARGUMENT_VECTOR3,
+		ARGUMENT_TRANSFORM,
+		ARGUMENT_TRANSFORM2D,
+		ARGUMENT_ARRAY,
+		ARGUMENT_DICTIONARY,
+		ARGUMENT_GAME_OBJECT,
+		ARGUMENT_RESOURCE,
+		ARGUMENT_POOL_INT_ARRAY,
+		ARGUMENT_POOL_VECTOR3_ARRAY
+	};
+
+	static const uint32_t LOG_MAGIC = 0x4C525757; // "WWRL"
+	static const uint32_t LOG_VERSION = 1;
+	static const uint32_t INVALID_GAME_OBJECT_INDEX = 0xFFFFFFFF;
+	static const int MAX_METHODS = 128;
+	// Arrays and dictionaries nested deeper than this are rejected rather than read recursively
+	static const int MAX_ARGUMENT_DEPTH = 64;
+	// Every frame up to the last call is rendered during a replay, an hour at 60 frames per second between two
+	// calls is more than any capture holds
+	static const uint32_t MAX_FRAME_GAP = 60 * 60 * 60;
+
+	struct Reader;
+
+	static void writeArgument(const Variant& argument);
+	static Variant readArgument(Reader& reader, std::vector<Node*>& gameObjects, const int depth);
+
+	static CAkLock lock;
+	static std::atomic<bool> recording;
+	static std::atomic<int> methodCount;
+	static const char* methodNames[MAX_METHODS];
+
+	static uint32_t frame;
+	static std::vector<uint8_t> buffer;
+	static std::unordered_map<int64_t, uint32_t> gameObjectIndices;
+};
+} // namespace godot
+
+// Records the enclosing API call and its arguments while a call log is being recorded
+#define WWISE_RECORD_CALL(name, ...)                                                                                   \
+	if (WwiseCallLog::isRecording())                                                                                   \
+	{                                                                                                                  \
+		static const int recordMethodID = WwiseCallLog::registerMethod(name);                                          \
+		WwiseCallLog::record(recordMethodID, {__VA_ARGS__});                                                           \
+	}
+
+#endif
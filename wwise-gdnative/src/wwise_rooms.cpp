@@ -0,0 +1,143 @@
+#include "wwise_rooms.h"
+
+using namespace godot;
+
+void WwiseRoomResolver::addVolume(const uint64_t roomID, const Transform& transform, const Vector3& extents,
+								  const int priority)
+{
+	volumes.add(WwiseVolume(roomID, transform, extents, priority, 0.0f));
+}
+
+void WwiseRoomResolver::removeRoom(const uint64_t roomID)
+{
+	volumes.removeOwner(roomID);
+}
+
+void WwiseRoomResolver::setPosition(const uint64_t gameObjectID, const Vector3& position)
+{
+	TrackedObject& trackedObject = trackedObjects[gameObjectID];
+	trackedObject.position = position;
+
+	if (!trackedObject.moved)
+	{
+		trackedObject.moved = true;
+		movedObjects.push_back(gameObjectID);
+	}
+}
+
+void WwiseRoomResolver::removeGameObject(const uint64_t gameObjectID)
+{
+	// Stale entries in movedObjects are skipped by resolve
+	trackedObjects.erase(gameObjectID);
+}
+
+uint64_t WwiseRoomResolver::getRoom(const uint64_t gameObjectID) const
+{
+	auto trackedObject = trackedObjects.find(gameObjectID);
+	return trackedObject != trackedObjects.end() ? trackedObject->second.roomID : NO_ROOM;
+}
+
+bool WwiseRoomResolver::resolveGameObject(const uint64_t gameObjectID, const Vector3& position, uint64_t& out_roomID)
+{
+	// The grid has to be up to date before it is queried, the next resolve still revisits every game object
+	if (volumes.update())
+	{
+		volumesChanged = true;
+	}
+
+	// A pending entry in movedObjects is skipped by resolve once the game object is no longer marked as moved
+	TrackedObject& trackedObject = trackedObjects[gameObjectID];
+	trackedObject.position = position;
+	trackedObject.moved = false;
+
+	const uint64_t roomID = findRoom(position);
+
+	if (roomID == trackedObject.roomID)
+	{
+		return false;
+	}
+
+	trackedObject.roomID = roomID;
+	out_roomID = roomID;
+	return true;
+}
+
+void WwiseRoomResolver::resolve(std::vector<RoomChange>& out_changes)
+{
+	const auto resolveObject = [this, &out_changes](const uint64_t gameObjectID, TrackedObject& trackedObject) {
+		trackedObject.moved = false;
+		const uint64_t roomID = findRoom(trackedObject.position);
+
+		if (roomID != trackedObject.roomID)
+		{
+			trackedObject.roomID = roomID;
+			out_changes.push_back({gameObjectID, roomID});
+		}
+	};
+
+	const bool rebuilt = volumes.update() || volumesChanged;
+	volumesChanged = false;
+
+	if (rebuilt)
+	{
+		for (auto& trackedObject : trackedObjects)
+		{
+			resolveObject(trackedObject.first, trackedObject.second);
+		}
+	}
+	else
+	{
+		for (const uint64_t gameObjectID : movedObjects)
+		{
+			auto trackedObject = trackedObjects.find(gameObjectID);
+
+			if (trackedObject != trackedObjects.end() && trackedObject->second.moved)
+			{
+				resolveObject(gameObjectID, trackedObject->second);
+			}
+		}
+	}
+
+	movedObjects.clear();
+}
+
+void WwiseRoomResolver::clear()
+{
+	volumes.clear();
+	trackedObjects.clear();
+	movedObjects.clear();
+	volumesChanged = false;
+}
+
+uint64_t WwiseRoomResolver::findRoom(const Vector3& position)
+{
+	const WwiseVolume* best = nullptr;
+
+	candidates.clear();
+	volumes.query(position, candidates);
+
+	for (const WwiseVolume* volume : candidates)
+	{
+		if (isBetter(*volume, best) && volume->contains(position))
+		{
+			best = volume;
+		}
+	}
+
+	return best ? best->ownerID : NO_ROOM;
+}
+
+bool WwiseRoomResolver::isBetter(const WwiseVolume& volume, const WwiseVolume* current) const
+{
+	if (!current)
+	{
+		return true;
+	}
+
+	if (volume.priority != current->priority)
+	{
+		return volume.priority > current->priority;
+	}
+
+	return volume.size < current->size;
+}
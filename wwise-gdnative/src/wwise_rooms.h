@@ -0,0 +1,63 @@
+#ifndef WWISE_ROOMS_H
+#define WWISE_ROOMS_H
+
+#include <Transform.hpp>
+#include <Vector3.hpp>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "wwise_volumes.h"
+
+namespace godot
+{
+// Finds the room of every positioned game object from the room volumes, replacing the Area signals of AkRoom. Only the
+// game objects that moved since the last resolve are looked up again, unless the volumes changed.
+class WwiseRoomResolver
+{
+  public:
+	static const uint64_t NO_ROOM = 0;
+
+	struct RoomChange
+	{
+		uint64_t gameObjectID;
+		uint64_t roomID;
+	};
+
+	// Where rooms overlap the one with the highest priority wins, then the smallest one so nested rooms work as is
+	void addVolume(const uint64_t roomID, const Transform& transform, const Vector3& extents, const int priority);
+	void removeRoom(const uint64_t roomID);
+
+	void setPosition(const uint64_t gameObjectID, const Vector3& position);
+	void removeGameObject(const uint64_t gameObjectID);
+	uint64_t getRoom(const uint64_t gameObjectID) const;
+
+	// Looks up the room of a single game object right away, returns true with its new room when it changed
+	bool resolveGameObject(const uint64_t gameObjectID, const Vector3& position, uint64_t& out_roomID);
+
+	// Appends the game objects whose room changed since the last call
+	void resolve(std::vector<RoomChange>& out_changes);
+	void clear();
+
+  private:
+	struct TrackedObject
+	{
+		Vector3 position;
+		uint64_t roomID = NO_ROOM;
+		bool moved = false;
+	};
+
+	uint64_t findRoom(const Vector3& position);
+	bool isBetter(const WwiseVolume& volume, const WwiseVolume* current) const;
+
+	WwiseVolumeGrid volumes;
+	std::vector<const WwiseVolume*> candidates;
+
+	std::unordered_map<uint64_t, TrackedObject> trackedObjects;
+	std::vector<uint64_t> movedObjects;
+	bool volumesChanged = false;
+};
+} // namespace godot
+
+#endif
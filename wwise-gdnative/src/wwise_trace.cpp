@@ -0,0 +1,283 @@
+#include "wwise_trace.h"
+
+#include <File.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+using namespace godot;
+
+std::atomic<bool> WwiseTraceRecorder::recording{false};
+std::atomic<uint64_t> WwiseTraceRecorder::writeIndex{0};
+std::vector<WwiseTraceRecorder::Event> WwiseTraceRecorder::events;
+std::chrono::steady_clock::time_point WwiseTraceRecorder::origin = std::chrono::steady_clock::now();
+
+static void AppendJsonString(std::string& out, const char* text)
+{
+	out += '"';
+
+	for (const char* c = text; *c; ++c)
+	{
+		switch (*c)
+		{
+		case '"':
+			out += "\\\"";
+			break;
+		case '\\':
+			out += "\\\\";
+			break;
+		case '\n':
+			out += "\\n";
+			break;
+		case '\t':
+			out += "\\t";
+			break;
+		default:
+			if (static_cast<unsigned char>(*c) >= 0x20)
+			{
+				out += *c;
+			}
+			break;
+		}
+	}
+
+	out += '"';
+}
+
+WwiseTraceRecorder::Scope::Scope(const char* name)
+	: name(name), value(-1), startUsec(0), active(recording.load(std::memory_order_relaxed))
+{
+	if (active)
+	{
+		startUsec = now();
+	}
+}
+
+WwiseTraceRecorder::Scope::~Scope()
+{
+	if (active)
+	{
+		recordComplete(name, startUsec, now() - startUsec, nullptr, value);
+	}
+}
+
+void WwiseTraceRecorder::Scope::setValue(const int64_t newValue)
+{
+	value = newValue;
+}
+
+bool WwiseTraceRecorder::start(const int capacity)
+{
+	if (recording || capacity <= 0)
+	{
+		return false;
+	}
+
+	events.assign(static_cast<size_t>(capacity), Event());
+	writeIndex = 0;
+	origin = std::chrono::steady_clock::now();
+	recording = true;
+
+	return true;
+}
+
+void WwiseTraceRecorder::stop()
+{
+	recording = false;
+}
+
+bool WwiseTraceRecorder::isRecording()
+{
+	return recording.load(std::memory_order_relaxed);
+}
+
+bool WwiseTraceRecorder::flush(const String path)
+{
+	if (recording)
+	{
+		// The ring buffer is only read once writers are stopped
+		return false;
+	}
+
+	const uint64_t written = writeIndex;
+	const uint64_t capacity = events.size();
+	const uint64_t count = written < capacity ? written : capacity;
+	const uint64_t first = written - count;
+
+	std::string json;
+	json.reserve(static_cast<size_t>(count) * 128 + 64);
+	json += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+	char buffer[256];
+	bool firstEvent = true;
+
+	for (uint64_t i = 0; i < count; ++i)
+	{
+		const Event& event = events[(first + i) % capacity];
+
+		if (!event.name)
+		{
+			continue;
+		}
+
+		if (!firstEvent)
+		{
+			json += ',';
+		}
+
+		firstEvent = false;
+
+		json += "{\"name\":";
+		AppendJsonString(json, event.name);
+
+		snprintf(buffer, sizeof(buffer), ",\"cat\":\"wwise\",\"ph\":\"%c\",\"pid\":1,\"tid\":%u,\"ts\":%llu",
+				 event.phase, event.threadID, static_cast<unsigned long long>(event.timestampUsec));
+		json += buffer;
+
+		if (event.phase == 'X')
+		{
+			snprintf(buffer, sizeof(buffer), ",\"dur\":%llu", static_cast<unsigned long long>(event.durationUsec));
+			json += buffer;
+		}
+		else if (event.phase == 'b' || event.phase == 'e')
+		{
+			snprintf(buffer, sizeof(buffer), ",\"id\":\"0x%llx\"", static_cast<unsigned long long>(event.id));
+			json += buffer;
+		}
+
+		if (event.detail[0] != '\0' || event.value >= 0)
+		{
+			json += ",\"args\":{";
+
+			if (event.detail[0] != '\0')
+			{
+				json += "\"detail\":";
+				AppendJsonString(json, event.detail);
+			}
+
+			if (event.value >= 0)
+			{
+				snprintf(buffer, sizeof(buffer), "%s\"value\":%lld", event.detail[0] != '\0' ? "," : "",
+						 static_cast<long long>(event.value));
+				json += buffer;
+			}
+
+			json += '}';
+		}
+
+		json += '}';
+	}
+
+	json += "]}";
+
+	File* const file = File::_new();
+
+	if (file->open(path, File::ModeFlags::WRITE) != Error::OK)
+	{
+		file->free();
+		return false;
+	}
+
+	file->store_string(String(json.c_str()));
+	file->close();
+	file->free();
+
+	return true;
+}
+
+void WwiseTraceRecorder::recordComplete(const char* name, const uint64_t startUsec, const uint64_t durationUsec,
+										const char* detail, const int64_t value)
+{
+	Event* event = acquireEvent();
+
+	if (!event)
+	{
+		return;
+	}
+
+	event->phase = 'X';
+	event->timestampUsec = startUsec;
+	event->durationUsec = durationUsec;
+	event->id = 0;
+	event->value = value;
+
+	if (detail)
+	{
+		strncpy(event->detail, detail, DETAIL_MAX_LENGTH - 1);
+		event->detail[DETAIL_MAX_LENGTH - 1] = '\0';
+	}
+
+	event->name = name;
+}
+
+void WwiseTraceRecorder::recordAsyncBegin(const char* name, const uint64_t id, const char* detail)
+{
+	Event* event = acquireEvent();
+
+	if (!event)
+	{
+		return;
+	}
+
+	event->phase = 'b';
+	event->timestampUsec = now();
+	event->durationUsec = 0;
+	event->id = id;
+	event->value = -1;
+
+	if (detail)
+	{
+		strncpy(event->detail, detail, DETAIL_MAX_LENGTH - 1);
+		event->detail[DETAIL_MAX_LENGTH - 1] = '\0';
+	}
+
+	event->name = name;
+}
+
+void WwiseTraceRecorder::recordAsyncEnd(const char* name, const uint64_t id, const int64_t value)
+{
+	Event* event = acquireEvent();
+
+	if (!event)
+	{
+		return;
+	}
+
+	event->phase = 'e';
+	event->timestampUsec = now();
+	event->durationUsec = 0;
+	event->id = id;
+	event->value = value;
+	event->name = name;
+}
+
+uint64_t WwiseTraceRecorder::now()
+{
+	return static_cast<uint64_t>(
+		std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - origin).count());
+}
+
+WwiseTraceRecorder::Event* WwiseTraceRecorder::acquireEvent()
+{
+	if (!recording.load(std::memory_order_relaxed))
+	{
+		return nullptr;
+	}
+
+	const uint64_t index = writeIndex.fetch_add(1, std::memory_order_relaxed);
+	Event* event = &events[index % events.size()];
+
+	event->threadID = getThreadID();
+	event->detail[0] = '\0';
+
+	return event;
+}
+
+uint32_t WwiseTraceRecorder::getThreadID()
+{
+	static std::atomic<uint32_t> nextThreadID{1};
+	thread_local const uint32_t threadID = nextThreadID.fetch_add(1);
+
+	return threadID;
+}
@@ -0,0 +1,78 @@
+#ifndef WWISE_TRACE_H
+#define WWISE_TRACE_H
+
+#include <String.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace godot
+{
+// Timeline recorder writing Chrome Trace Event JSON (also readable by Perfetto). Events go into a ring buffer that is
+// allocated when tracing starts, so recording never allocates and the oldest events are overwritten once it is full.
+class WwiseTraceRecorder
+{
+  public:
+	static const int DETAIL_MAX_LENGTH = 64;
+
+	class Scope
+	{
+	  public:
+		explicit Scope(const char* name);
+		~Scope();
+
+		void setValue(const int64_t value);
+
+	  private:
+		const char* name;
+		int64_t value;
+		uint64_t startUsec;
+		bool active;
+	};
+
+	static bool start(const int capacity);
+	static void stop();
+	static bool isRecording();
+
+	// Writes the recorded events to path, user:// paths are supported
+	static bool flush(const String path);
+
+	static void recordComplete(const char* name, const uint64_t startUsec, const uint64_t durationUsec,
+							   const char* detail = nullptr, const int64_t value = -1);
+	static void recordAsyncBegin(const char* name, const uint64_t id, const char* detail = nullptr);
+	static void recordAsyncEnd(const char* name, const uint64_t id, const int64_t value = -1);
+
+	static uint64_t now();
+
+  private:
+	struct Event
+	{
+		const char* name;
+		char phase;
+		uint32_t threadID;
+		uint64_t timestampUsec;
+		uint64_t durationUsec;
+		uint64_t id;
+		int64_t value;
+		char detail[DETAIL_MAX_LENGTH];
+	};
+
+	static Event* acquireEvent();
+	static uint32_t getThreadID();
+
+	static std::atomic<bool> recording;
+	static std::atomic<uint64_t> writeIndex;
+	static std::vector<Event> events;
+	static std::chrono::steady_clock::time_point origin;
+};
+} // namespace godot
+
+#define WWISE_TRACE_CONCAT_IMPL(a, b) a##b
+#define WWISE_TRACE_CONCAT(a, b) WWISE_TRACE_CONCAT_IMPL(a, b)
+
+// Records a complete event covering the rest of the enclosing block
+#define WWISE_TRACE_SCOPE(name) WwiseTraceRecorder::Scope WWISE_TRACE_CONCAT(traceScope, __LINE__)(name)
+
+#endif
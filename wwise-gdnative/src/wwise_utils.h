@@ -5,6 +5,9 @@
 #include "AK/SoundEngine/Common/AkCallback.h"
 #include "File.hpp"
 
+#include <chrono>
+#include <cstdint>
+
 using namespace godot;
 
 const float INVALID_RTPC_VALUE = 1.0f;
@@ -35,6 +38,55 @@ enum SampleRate
 	RATE_48000
 };
 
+enum RenderTickMode
+{
+	RENDER_FRAME = 0,
+	PHYSICS_FRAME,
+	FIXED_RATE_THREAD
+};
+
+// Last, peak and smoothed average of a recurring duration
+struct WwiseTimingStats
+{
+	int64_t lastUsec = 0;
+	int64_t peakUsec = 0;
+	double averageUsec = 0.0;
+	uint64_t count = 0;
+
+	void record(const int64_t durationUsec)
+	{
+		// Exponential moving average over roughly the last 60 samples
+		const double smoothing = 1.0 / 60.0;
+
+		lastUsec = durationUsec;
+		peakUsec = durationUsec > peakUsec ? durationUsec : peakUsec;
+
+		if (count == 0)
+		{
+			averageUsec = static_cast<double>(durationUsec);
+		}
+		else
+		{
+			averageUsec += (static_cast<double>(durationUsec) - averageUsec) * smoothing;
+		}
+
+		++count;
+	}
+
+	void reset()
+	{
+		*this = WwiseTimingStats();
+	}
+};
+
+// Monotonic microsecond clock, safe to use from any thread
+static inline int64_t GetTicksUsec()
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(
+			   std::chrono::steady_clock::now().time_since_epoch())
+		.count();
+}
+
 static const char* WwiseErrorString(AKRESULT errcode)
 {
 	switch (errcode)
@@ -271,17 +323,4 @@ static inline void GetAkVector(const Transform& t, AkVector& outVector, const Ve
 	}
 }
 
-static inline bool FindMatchingVertex(Vector3 vertex, Dictionary vertDict, int& outIdx)
-{
-	if (vertDict.has(vertex))
-	{
-		outIdx = vertDict[vertex];
-		return true;
-	}
-	else
-	{
-		return false;
-	}
-}
-
 #endif
\ No newline at end of file
@@ -0,0 +1,167 @@
+#include "wwise_volumes.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace godot;
+
+WwiseVolume::WwiseVolume(const uint64_t ownerID, const Transform& transform, const Vector3& extents,
+						 const int priority, const float margin)
+	: ownerID(ownerID),
+	  transform(transform),
+	  inverseTransform(transform.affine_inverse()),
+	  extents(extents),
+	  priority(priority),
+	  margin(std::max(margin, 0.0f))
+{
+	// World space bounds of the box, each axis grows by the extents projected on it
+	Vector3 halfSize;
+	real_t* halfSizeAxes[3] = {&halfSize.x, &halfSize.y, &halfSize.z};
+
+	for (int axis = 0; axis < 3; ++axis)
+	{
+		const Vector3 row = transform.basis.elements[axis];
+		*halfSizeAxes[axis] =
+			std::abs(row.x) * extents.x + std::abs(row.y) * extents.y + std::abs(row.z) * extents.z + this->margin;
+	}
+
+	const Vector3 scale = transform.basis.get_scale();
+	size = extents.x * scale.x * extents.y * scale.y * extents.z * scale.z;
+	boundsMin = transform.origin - halfSize;
+	boundsMax = transform.origin + halfSize;
+}
+
+bool WwiseVolume::contains(const Vector3& position) const
+{
+	const Vector3 local = inverseTransform.xform(position);
+
+	return std::abs(local.x) <= extents.x && std::abs(local.y) <= extents.y && std::abs(local.z) <= extents.z;
+}
+
+float WwiseVolume::distance(const Vector3& position) const
+{
+	const Vector3 local = inverseTransform.xform(position);
+	const Vector3 clamped(std::max(-extents.x, std::min(local.x, extents.x)),
+						  std::max(-extents.y, std::min(local.y, extents.y)),
+						  std::max(-extents.z, std::min(local.z, extents.z)));
+
+	// Measured back in world space so scaled volumes fade over the same distance as the others
+	const Vector3 offset = transform.basis.xform(local - clamped);
+	return std::sqrt(offset.x * offset.x + offset.y * offset.y + offset.z * offset.z);
+}
+
+void WwiseVolumeGrid::add(const WwiseVolume& volume)
+{
+	volumes.push_back(volume);
+	dirty = true;
+}
+
+bool WwiseVolumeGrid::removeOwner(const uint64_t ownerID)
+{
+	const size_t volumeCount = volumes.size();
+
+	volumes.erase(std::remove_if(volumes.begin(), volumes.end(),
+								 [ownerID](const WwiseVolume& volume) { return volume.ownerID == ownerID; }),
+				  volumes.end());
+
+	const bool removed = volumes.size() != volumeCount;
+	dirty = dirty || removed;
+
+	return removed;
+}
+
+void WwiseVolumeGrid::clear()
+{
+	volumes.clear();
+	cells.clear();
+	largeVolumes.clear();
+	dirty = false;
+}
+
+bool WwiseVolumeGrid::update()
+{
+	if (!dirty)
+	{
+		return false;
+	}
+
+	dirty = false;
+	cells.clear();
+	largeVolumes.clear();
+
+	if (volumes.empty())
+	{
+		return true;
+	}
+
+	float totalSize = 0.0f;
+
+	for (const WwiseVolume& volume : volumes)
+	{
+		const Vector3 size = volume.boundsMax - volume.boundsMin;
+		totalSize += std::max(size.x, std::max(size.y, size.z));
+	}
+
+	cellSize = std::max(totalSize / static_cast<float>(volumes.size()), 0.001f);
+
+	for (uint32_t v = 0; v < volumes.size(); ++v)
+	{
+		const WwiseVolume& volume = volumes[v];
+		const int64_t minX = cellCoordinate(volume.boundsMin.x);
+		const int64_t minY = cellCoordinate(volume.boundsMin.y);
+		const int64_t minZ = cellCoordinate(volume.boundsMin.z);
+		const int64_t maxX = cellCoordinate(volume.boundsMax.x);
+		const int64_t maxY = cellCoordinate(volume.boundsMax.y);
+		const int64_t maxZ = cellCoordinate(volume.boundsMax.z);
+
+		if ((maxX - minX + 1) * (maxY - minY + 1) * (maxZ - minZ + 1) > MAX_VOLUME_CELLS)
+		{
+			largeVolumes.push_back(v);
+			continue;
+		}
+
+		for (int64_t x = minX; x <= maxX; ++x)
+		{
+			for (int64_t y = minY; y <= maxY; ++y)
+			{
+				for (int64_t z = minZ; z <= maxZ; ++z)
+				{
+					cells[cellKey(x, y, z)].push_back(v);
+				}
+			}
+		}
+	}
+
+	return true;
+}
+
+void WwiseVolumeGrid::query(const Vector3& position, std::vector<const WwiseVolume*>& out_volumes) const
+{
+	for (const uint32_t v : largeVolumes)
+	{
+		out_volumes.push_back(&volumes[v]);
+	}
+
+	auto cell = cells.find(cellKey(cellCoordinate(position.x), cellCoordinate(position.y), cellCoordinate(position.z)));
+
+	if (cell != cells.end())
+	{
+		for (const uint32_t v : cell->second)
+		{
+			out_volumes.push_back(&volumes[v]);
+		}
+	}
+}
+
+int64_t WwiseVolumeGrid::cellCoordinate(const float value) const
+{
+	return static_cast<int64_t>(std::floor(value / cellSize));
+}
+
+uint64_t WwiseVolumeGrid::cellKey(const int64_t x, const int64_t y, const int64_t z)
+{
+	// 21 bits per axis, cells far enough apart to wrap only share a bucket and are still tested exactly
+	const uint64_t mask = (1ull << 21) - 1;
+	return (static_cast<uint64_t>(x) & mask) | ((static_cast<uint64_t>(y) & mask) << 21) |
+		   ((static_cast<uint64_t>(z) & mask) << 42);
+}
@@ -0,0 +1,72 @@
+#ifndef WWISE_VOLUMES_H
+#define WWISE_VOLUMES_H
+
+#include <Transform.hpp>
+#include <Vector3.hpp>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace godot
+{
+// Oriented box owned by a node, rooms and environment zones are made of these
+struct WwiseVolume
+{
+	uint64_t ownerID = 0;
+	Transform transform;
+	Transform inverseTransform;
+	Vector3 extents;
+	int priority = 0;
+	// Positions up to this far outside the box are still returned by WwiseVolumeGrid::query
+	float margin = 0.0f;
+	float size = 0.0f;
+	Vector3 boundsMin;
+	Vector3 boundsMax;
+
+	WwiseVolume() = default;
+	WwiseVolume(const uint64_t ownerID, const Transform& transform, const Vector3& extents, const int priority,
+				const float margin);
+
+	bool contains(const Vector3& position) const;
+	// World space distance from the surface of the box, 0 inside it
+	float distance(const Vector3& position) const;
+};
+
+// Uniform grid over the volume bounds grown by their margin, with cells the size of an average volume so each one
+// lands in a handful of cells. Volumes spanning too many cells are kept aside and tested for every query.
+class WwiseVolumeGrid
+{
+  public:
+	void add(const WwiseVolume& volume);
+	// Returns whether a volume of the owner was removed
+	bool removeOwner(const uint64_t ownerID);
+	void clear();
+
+	// Rebuilds the grid after volumes were added or removed, returns whether it had to
+	bool update();
+
+	// Appends the volumes that may be within their margin of the position, callers still test them exactly
+	void query(const Vector3& position, std::vector<const WwiseVolume*>& out_volumes) const;
+
+	bool empty() const
+	{
+		return volumes.empty();
+	}
+
+  private:
+	static const int MAX_VOLUME_CELLS = 512;
+
+	int64_t cellCoordinate(const float value) const;
+	static uint64_t cellKey(const int64_t x, const int64_t y, const int64_t z);
+
+	std::vector<WwiseVolume> volumes;
+	bool dirty = false;
+
+	float cellSize = 1.0f;
+	std::unordered_map<uint64_t, std::vector<uint32_t>> cells;
+	std::vector<uint32_t> largeVolumes;
+};
+} // namespace godot
+
+#endif